@@ -27,14 +27,17 @@
 #ifndef Button_H
 #define Button_H
 
+#include "MidiAccompanimentController.h"
 #include "ButtonState.h"
 
 typedef struct
 {
   ButtonState buttonState;
   
+#ifndef DEBOUNCE_VERTICAL_COUNTER
   // The last time the button state was toggled. Used for debouncing button.
   unsigned long lastToggleTimeMs;
+#endif
 } Button;
 
 #endif
@@ -24,6 +24,7 @@
   
  ******************************************************************************/
 
+
 #ifndef ButtonChangedHandlerBase_H
 #define ButtonChangedHandlerBase_H
 
@@ -33,13 +34,21 @@
 #include "../Button.h"
 #include "../SharedConstants.h"
 
-// This abstract class provides an interface to handle button state changes. 
+// This class template provides an interface to handle button state changes.
+// TDerived implements HandleButtonChangeImpl(); the call is bound at compile time, so it can be inlined, and no vtable is kept in RAM.
+template <class TDerived>
 class ButtonChangedHandlerBase
 { 
 public:
-  ButtonChangedHandlerBase();
+  // This method handles the state change of buttons[buttonIndex].
+  void HandleButtonChange(Button* buttons, byte buttonIndex)
+  {
+    static_cast<TDerived*>(this)->HandleButtonChangeImpl(buttons, buttonIndex);
+  }
 
-  virtual void HandleButtonChange(Button* button, byte buttonIndex) = 0;
+protected:
+  // The constructor is protected; this class is only used as a base class.
+  ButtonChangedHandlerBase() {}
 };
 
 #endif
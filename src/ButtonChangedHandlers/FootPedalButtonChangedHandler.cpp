@@ -32,18 +32,78 @@
 #include "../SharedMacros.h"
 #include "../SharedConstants.h"
 
-extern FootPedalSwitchChangeManager gFootPedalSwitchChangeManager; // TODO: Inject dependency.
+#ifdef DETECT_PEDAL_GESTURES
+  #include "../PedalGestureEngine.h"
+#endif
+
+#ifdef DETECT_PEDAL_COMBOS
+  #include "../PedalComboResolver.h"
+#endif
+
+#ifdef SLEEP_WHEN_IDLE
+  #include "../IdleSleepManager.h"
+#endif
 
 // This class handles Right Hand Arduino Increment/Decrement Program button changes. 
 // It sends corresponding MIDI Program Change message.
-FootPedalButtonChangedHandler::FootPedalButtonChangedHandler()
+FootPedalButtonChangedHandler::FootPedalButtonChangedHandler(FootPedalSwitchChangeManager& footPedalSwitchChangeManager
+#ifdef DETECT_PEDAL_COMBOS
+  , PedalComboResolver& pedalComboResolver
+#endif
+#ifdef DETECT_PEDAL_GESTURES
+  , PedalGestureEngine& pedalGestureEngine
+#endif
+#ifdef SLEEP_WHEN_IDLE
+  , IdleSleepManager& idleSleepManager
+#endif
+  ) :
+  mFootPedalSwitchChangeManager(footPedalSwitchChangeManager)
+#ifdef DETECT_PEDAL_COMBOS
+  , mPedalComboResolver(pedalComboResolver)
+#endif
+#ifdef DETECT_PEDAL_GESTURES
+  , mPedalGestureEngine(pedalGestureEngine)
+#endif
+#ifdef SLEEP_WHEN_IDLE
+  , mIdleSleepManager(idleSleepManager)
+#endif
 {
 }
 
-void FootPedalButtonChangedHandler::HandleButtonChange(Button* buttons, byte buttonIndex)
+void FootPedalButtonChangedHandler::HandleButtonChangeImpl(Button* buttons, byte buttonIndex)
 {
   bool isActive = buttons[buttonIndex].buttonState.active;
 
-  // DBG_PRINT_LN("FootPedalButtonChangedHandler::HandleButtonChange() - buttons["+String(buttonIndex)+"] @ Pin "+String(buttons[buttonIndex].buttonState.pin)+"= "+String(buttons[buttonIndex].buttonState.active)+".");
-  gFootPedalSwitchChangeManager.HandleButtonChange(buttonIndex, isActive);
+  // DBG_PRINT_LN("FootPedalButtonChangedHandler::HandleButtonChangeImpl() - buttons["+String(buttonIndex)+"] @ Pin "+String(buttons[buttonIndex].buttonState.pin)+"= "+String(buttons[buttonIndex].buttonState.active)+".");
+#ifdef DETECT_PEDAL_COMBOS
+  mPedalComboResolver.OnButtonChange(buttonIndex, isActive);
+#else
+  mFootPedalSwitchChangeManager.HandleButtonChange(buttonIndex, isActive);
+#endif
+
+#ifdef DETECT_PEDAL_GESTURES
+  // The press or release is handled first, so gestures add no latency to it.
+  mPedalGestureEngine.OnButtonChange(buttonIndex, isActive);
+
+#ifdef DETECT_PEDAL_COMBOS
+  // A press that completes a combo consumes the combo's pedals, so they send no gestures either;
+  // e.g., the tempo pedals of a tempo reset do not send long press and hold repeats while they are held.
+  PedalFlags consumedPedalFlags = mPedalComboResolver.GetConsumedPedalFlags();
+  if (isActive && (consumedPedalFlags & ((PedalFlags)1 << buttonIndex)) != 0)
+  {
+    for (byte i = 0; consumedPedalFlags != 0; i++, consumedPedalFlags >>= 1)
+    {
+      if ((consumedPedalFlags & 1) != 0)
+      {
+        mPedalGestureEngine.CancelPedal(i);
+      }
+    }
+  }
+#endif
+#endif
+
+#ifdef SLEEP_WHEN_IDLE
+  // The pedal's MIDI bytes, if any, are queued; this ends the wake latency measurement.
+  mIdleSleepManager.OnPedalChange();
+#endif
 }
\ No newline at end of file
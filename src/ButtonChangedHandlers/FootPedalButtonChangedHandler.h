@@ -34,12 +34,48 @@
 #include "../Button.h"
 #include "ButtonChangedHandlerBase.h"
 
-class FootPedalButtonChangedHandler : public ButtonChangedHandlerBase
+class FootPedalSwitchChangeManager;
+class PedalGestureEngine;
+class PedalComboResolver;
+class IdleSleepManager;
+
+// This class handles foot pedal button changes, by forwarding them to the Foot Pedal Switch Change Manager
+// (through the Pedal Combo Resolver, when detecting combos), and to the other pedal stages that are built.
+// The stages are passed to the constructor; their calls are direct, so the press-to-MIDI path can be inlined.
+class FootPedalButtonChangedHandler : public ButtonChangedHandlerBase<FootPedalButtonChangedHandler>
 {
+  friend class ButtonChangedHandlerBase<FootPedalButtonChangedHandler>;
+
 public:
-  FootPedalButtonChangedHandler();
+  FootPedalButtonChangedHandler(FootPedalSwitchChangeManager& footPedalSwitchChangeManager
+#ifdef DETECT_PEDAL_COMBOS
+    , PedalComboResolver& pedalComboResolver
+#endif
+#ifdef DETECT_PEDAL_GESTURES
+    , PedalGestureEngine& pedalGestureEngine
+#endif
+#ifdef SLEEP_WHEN_IDLE
+    , IdleSleepManager& idleSleepManager
+#endif
+    );
+
+private:
+  void HandleButtonChangeImpl(Button* buttons, byte buttonIndex);
 
-  virtual void HandleButtonChange(Button* button, byte buttonIndex);
+private:
+  FootPedalSwitchChangeManager& mFootPedalSwitchChangeManager;
+
+#ifdef DETECT_PEDAL_COMBOS
+  PedalComboResolver& mPedalComboResolver;
+#endif
+
+#ifdef DETECT_PEDAL_GESTURES
+  PedalGestureEngine& mPedalGestureEngine;
+#endif
+
+#ifdef SLEEP_WHEN_IDLE
+  IdleSleepManager& mIdleSleepManager;
+#endif
 };
 
 #endif
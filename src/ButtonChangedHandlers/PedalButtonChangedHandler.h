@@ -0,0 +1,46 @@
+/*******************************************************************************
+  PedalButtonChangedHandler.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+#ifndef PedalButtonChangedHandler_H
+#define PedalButtonChangedHandler_H
+
+#include "../MidiAccompanimentController.h"
+
+// PedalButtonChangedHandler is the handler the buttons managers send pedal changes to. It is chosen at compile time,
+// so the buttons managers call it directly, rather than through a virtual call.
+#ifdef SEND_PEDAL_LINK
+  #include "PedalLinkButtonChangedHandler.h"
+
+  // The remote board sends its pedal changes to the main controller.
+  typedef PedalLinkButtonChangedHandler PedalButtonChangedHandler;
+#else
+  #include "FootPedalButtonChangedHandler.h"
+
+  typedef FootPedalButtonChangedHandler PedalButtonChangedHandler;
+#endif
+
+#endif
@@ -30,13 +30,14 @@
 #include <Arduino.h>
 
 // The ButtonState structure contains an indication whether the button is pressed, and its pin number.
+// The bounce fields are used by AdaptiveDebounceTuner, when ADAPTIVE_DEBOUNCE is defined.
 typedef struct
 {
-    uint32_t    active    :  1; //  1 false/true
-    uint32_t    pin       :  7; //  8 0 - 127
-    uint32_t    unused0   : 10; // 18 0 - 1023
-    uint32_t    unused1   :  7; // 25 0 - 127
-    uint32_t    unused2   :  7; // 32 0 - 127
+    uint32_t    active            :  1; //  1 false/true
+    uint32_t    pin               :  7; //  8 0 - 127
+    uint32_t    bounceTimeMs      : 10; // 18 0 - 1023 Time from the last toggle to its last bounce.
+    uint32_t    bounceP99Ms       :  7; // 25 0 - 127  Estimated 99th percentile bounce time.
+    uint32_t    numBouncesAtP99   :  7; // 32 0 - 127  Bounces at or below bounceP99Ms since it last changed.
 } ButtonState;
 
 #endif
@@ -35,6 +35,10 @@
 
 extern Button gFootPedalButtons[NumFootPedalButtons];
 
+#ifdef READ_LADDER_PEDALS
+extern FreeRunningAdc gFreeRunningAdc;
+#endif
+
 // Used only by RH Arduino to keep track of both LH Arduino and RH Arduino buttons and sensors.
 // It contains utilty functions to update LH buttons given corresponding button flags.
 ButtonsManager::ButtonsManager(Button* footPedalButtons) :
@@ -42,15 +46,58 @@ ButtonsManager::ButtonsManager(Button* footPedalButtons) :
 {
 }
 
+void ButtonsManager::Setup()
+{
+#ifdef SCAN_PEDAL_PORTS
+  // The pedal board pins are set by FootPedalSetupManager::Setup(), which is called first.
+  mPedalPortScanner.Setup(mFootPedalButtons, NumDigitalPedals);
+#endif
+
+#ifdef ADAPTIVE_DEBOUNCE
+  mAdaptiveDebounceTuner.Load(mFootPedalButtons, NumFootPedalButtons);
+#endif
+
+#ifdef READ_PEDALS_FROM_SHIFT_REGISTERS
+  mShiftRegisterPedalInput.Setup();
+#endif
+
+#ifdef READ_LADDER_PEDALS
+  mResistorLadderPedalInput.Setup(gFreeRunningAdc);
+#endif
+
+#ifdef CAPTURE_PEDAL_EDGES
+  mPedalEdgeCapture.Setup(mPedalPortScanner, mFootPedalButtons, NumFootPedalButtons);
+  mCapturedPressedFlags = mPedalPortScanner.ReadPressedFlags();
+#endif
+
+#ifdef SCHEDULE_PEDAL_SCANS
+  mPedalScanScheduler.Setup(mPedalPortScanner);
+  mCapturedPressedFlags = mPedalPortScanner.ReadPressedFlags();
+#endif
+}
+
 // This method reads the digital input pin corresponding the the buttons passed in, after the debounce time has elapsed.
 // It is used by both the RH and LH Arduinos.
-void ButtonsManager::ReadButtons(Button* buttons, int startButtonIndex, int endButtonIndex, ButtonChangedHandlerBase& buttonChangedHandler)
+void ButtonsManager::ReadButtons(Button* buttons, int startButtonIndex, int endButtonIndex, PedalButtonChangedHandler& buttonChangedHandler)
 {
   // DBG_PRINT_LN("ButtonsManager::ReadButtons() - Started.");
+#if defined(DEBOUNCE_VERTICAL_COUNTER)
+  if (!mVerticalCounterDebouncer.IsSampleDue())
+  {
+    return;
+  }
+
+  PedalFlags pressedFlags = mVerticalCounterDebouncer.Update(ReadPressedFlags());
+  UpdateButtons(buttons, startButtonIndex, endButtonIndex, pressedFlags, buttonChangedHandler, 0);
+#elif defined(CAPTURE_PEDAL_EDGES) || defined(SCHEDULE_PEDAL_SCANS)
+  ReadCapturedButtons(buttons, startButtonIndex, endButtonIndex, buttonChangedHandler);
+#elif defined(SCAN_PEDAL_PORTS) || defined(READ_PEDALS_FROM_SHIFT_REGISTERS)
+  UpdateButtons(buttons, startButtonIndex, endButtonIndex, ReadPressedFlags(), buttonChangedHandler, millis());
+#else
   bool newButtonState = false;
   for (byte i = startButtonIndex; i <= endButtonIndex; i++)
   {
-     if (!IsButtonDebounced(buttons[i]))
+     if (!IsButtonDebounced(buttons[i], millis()))
     {
       continue;
     }
@@ -78,21 +125,158 @@ void ButtonsManager::ReadButtons(Button* buttons, int startButtonIndex, int endB
 
     buttonChangedHandler.HandleButtonChange(buttons, i);
   }
+#endif
+}
+
+#if defined(SCAN_PEDAL_PORTS) || defined(READ_PEDALS_FROM_SHIFT_REGISTERS)
+// This method returns the pressed flags of all pedals, read from the configured pedal input.
+PedalFlags ButtonsManager::ReadPressedFlags()
+{
+#ifdef READ_PEDALS_FROM_SHIFT_REGISTERS
+  PedalFlags pressedFlags = mShiftRegisterPedalInput.ReadPressedFlags();
+#else
+  PedalFlags pressedFlags = mPedalPortScanner.ReadPressedFlags();
+#endif
+
+#ifdef READ_LADDER_PEDALS
+  pressedFlags |= mResistorLadderPedalInput.ReadPressedFlags() << LadderFirstPedalIndex;
+#endif
 
+#ifdef RECEIVE_PEDAL_LINK
+  ReadLinkedButtonFlags();
+  pressedFlags |= mNewFootSwitchesButtonFlags << RemoteFirstPedalIndex;
+#endif
+
+  return pressedFlags;
 }
+#endif
+
+// This method compares the pressed flags passed in against the current button flags, and handles only the changed buttons.
+// A changed button that is not yet debounced keeps its current flag, so it is detected again on a later scan.
+// curTimeMs is the time the pressed flags were read; it is not used by the vertical counter debouncer.
+void ButtonsManager::UpdateButtons(Button* buttons, int startButtonIndex, int endButtonIndex, PedalFlags pressedFlags, PedalButtonChangedHandler& buttonChangedHandler, unsigned long curTimeMs)
+{
+#ifdef DEBOUNCE_VERTICAL_COUNTER
+  (void)curTimeMs;
+#endif
+
+  PedalFlags rangeFlags = (PedalFlags)(((PedalFlags)2 << endButtonIndex) - ((PedalFlags)1 << startButtonIndex));
+  PedalFlags changedFlags = (pressedFlags ^ mCurFootPedalButtonFlags) & rangeFlags;
+
+#ifdef ADAPTIVE_DEBOUNCE
+  mAdaptiveDebounceTuner.OnScan(buttons, pressedFlags, curTimeMs);
+#endif
+
+  PedalFlags buttonFlag = (PedalFlags)1 << startButtonIndex;
+  for (byte i = startButtonIndex; changedFlags != 0; i++, buttonFlag <<= 1)
+  {
+    if ((changedFlags & buttonFlag) == 0)
+    {
+      continue;
+    }
+
+    changedFlags &= ~buttonFlag;
+
+#ifndef DEBOUNCE_VERTICAL_COUNTER
+    if (!IsButtonDebounced(buttons[i], curTimeMs))
+    {
+      continue;
+    }
+#endif
 
+    // Button state changed. Save its state.
+    mCurFootPedalButtonFlags ^= buttonFlag;
+    buttons[i].buttonState.active = (pressedFlags & buttonFlag) != 0;
+#ifndef DEBOUNCE_VERTICAL_COUNTER
+    buttons[i].lastToggleTimeMs = curTimeMs;
+#endif
+
+#ifdef ADAPTIVE_DEBOUNCE
+    mAdaptiveDebounceTuner.OnButtonToggled(buttons[i], buttonFlag);
+#endif
+
+    buttonChangedHandler.HandleButtonChange(buttons, i);
+  }
+}
+
+#ifdef RECEIVE_PEDAL_LINK
+void ButtonsManager::ReadLinkedButtonFlags()
+{
+  if (mPedalLinkReceiver.Update())
+  {
+    for (uint8_t i = 0; i < NumPedalLinkBitmapBytes; i++)
+    {
+      UpdateNewButtonFlags(mPedalLinkReceiver.GetBitmapByte(i), i);
+    }
+  }
+  else if (mNewFootSwitchesButtonFlags != 0 && mPedalLinkReceiver.IsTimedOut())
+  {
+    // The link is down; release the remote pedals rather than leave them stuck.
+    DBG_PRINT_LN("ButtonsManager::ReadLinkedButtonFlags() - Pedal link timed out.");
+    mNewFootSwitchesButtonFlags = 0;
+  }
+}
+#endif
+
+void ButtonsManager::UpdateNewButtonFlags(uint8_t receivedByte, int index)
+{
+  const PedalFlags linkedPedalsMask = ((PedalFlags)1 << NumLinkedPedals) - 1;
+
+  uint8_t shift = index * 7;
+  PedalFlags byteMask = ((PedalFlags)0x7F << shift) & linkedPedalsMask;
+  mNewFootSwitchesButtonFlags = (mNewFootSwitchesButtonFlags & ~byteMask) | (((PedalFlags)receivedByte << shift) & byteMask);
+}
+
+#if defined(CAPTURE_PEDAL_EDGES) || defined(SCHEDULE_PEDAL_SCANS)
+void ButtonsManager::ReadCapturedButtons(Button* buttons, int startButtonIndex, int endButtonIndex, PedalButtonChangedHandler& buttonChangedHandler)
+{
+#ifdef CAPTURE_PEDAL_EDGES
+  PedalEdgeCapture& pedalEventSource = mPedalEdgeCapture;
+#else
+  PedalScanScheduler& pedalEventSource = mPedalScanScheduler;
+  pedalEventSource.ReportScanJitter();
+#endif
+
+  PedalEvent pedalEvent;
+  while (pedalEventSource.PopEvent(pedalEvent))
+  {
+    mCapturedPressedFlags = pedalEvent.pressedFlags;
+    // micros() / 1000 wraps long before millis(); convert the event's age instead, so the time is on the millis() clock.
+    mCapturedTimeMs = millis() - (micros() - pedalEvent.timestampMicroseconds) / 1000;
+    UpdateButtons(buttons, startButtonIndex, endButtonIndex, mCapturedPressedFlags, buttonChangedHandler, mCapturedTimeMs);
+  }
+
+  uint16_t numOverflows = pedalEventSource.GetNumOverflows();
+  if (numOverflows != mNumReportedCaptureOverflows)
+  {
+    // Pedal events were dropped; the last captured flags may be stale. Resynchronize with the pins.
+    DBG_PRINT_LN("ButtonsManager::ReadCapturedButtons() - Pedal event ring overflows = " + String(numOverflows) + ".");
+    mNumReportedCaptureOverflows = numOverflows;
+    mCapturedPressedFlags = mPedalPortScanner.ReadPressedFlags();
+  }
+
+  // A pedal whose last edge fell within its debounce time has no later edge to report it; handle it once its debounce time has elapsed.
+  UpdateButtons(buttons, startButtonIndex, endButtonIndex, mCapturedPressedFlags, buttonChangedHandler, millis());
+}
+#endif
+
+#ifndef DEBOUNCE_VERTICAL_COUNTER
 // TODO: bjk 220111 Move debounce into button class, per https://roboticsbackend.com/arduino-object-oriented-programming-oop/
 // Returns true if it is OK to handle button state toggle.
 // This function returns true if the time between the current time and
 // the last button state toggle time is greater than the debounce time.
-bool ButtonsManager::IsButtonDebounced(const Button& button)
+bool ButtonsManager::IsButtonDebounced(const Button& button, unsigned long curTimeMs)
 {
-  unsigned long curTimeMs = millis();
-
   // Ignore current state until past the button settling time.
   unsigned long elapsedTimeMs = curTimeMs - button.lastToggleTimeMs;
 
-  if (elapsedTimeMs < DebounceDelayMs) {
+#ifdef ADAPTIVE_DEBOUNCE
+  unsigned long debounceDelayMs = AdaptiveDebounceTuner::GetDebounceDelayMs(button);
+#else
+  unsigned long debounceDelayMs = mDebounceDelayMs;
+#endif
+
+  if (elapsedTimeMs < debounceDelayMs) {
     // Last button toggle time is too recent. Prevent changing its state.
 //    if (button.buttonState.active) {
 //      DBG_PRINT_LN("Button " + String(button.buttonState.pin) + " elapsedTimeMs = " + String(elapsedTimeMs));
@@ -108,3 +292,4 @@ bool ButtonsManager::IsButtonDebounced(const Button& button)
     return true;
   }
 }
+#endif
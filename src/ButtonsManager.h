@@ -30,31 +30,130 @@
 #include "MidiAccompanimentController.h"
 
 #include "Button.h"
-#include "ButtonChangedHandlers/ButtonChangedHandlerBase.h"
+#include "PedalFlags.h"
+#include "ButtonChangedHandlers/PedalButtonChangedHandler.h"
+
+#ifdef SCAN_PEDAL_PORTS
+  #include "PedalInputs/PedalPortScanner.h"
+#endif
+
+#ifdef READ_PEDALS_FROM_SHIFT_REGISTERS
+  #include "PedalInputs/ShiftRegisterPedalInput.h"
+#endif
+
+#ifdef READ_LADDER_PEDALS
+  #include "PedalInputs/ResistorLadderPedalInput.h"
+#endif
+
+#ifdef DEBOUNCE_VERTICAL_COUNTER
+  #include "Debouncers/VerticalCounterDebouncer.h"
+#endif
+
+#ifdef ADAPTIVE_DEBOUNCE
+  #include "Debouncers/AdaptiveDebounceTuner.h"
+#endif
+
+#ifdef CAPTURE_PEDAL_EDGES
+  #include "PedalInputs/PedalEdgeCapture.h"
+#endif
+
+#ifdef SCHEDULE_PEDAL_SCANS
+  #include "PedalInputs/PedalScanScheduler.h"
+#endif
+
+#ifdef RECEIVE_PEDAL_LINK
+  #include "PedalLink/PedalLinkReceiver.h"
+#endif
 
 class ButtonsManager {
 
 private:
   Button* mFootPedalButtons;
-  uint16_t mCurFootPedalButtonFlags = 0;
+  PedalFlags mCurFootPedalButtonFlags = 0;
+  uint8_t mDebounceDelayMs = DebounceDelayMs;
 
 public:
   ButtonsManager(Button* footPedalButtons);
 
-  void ReadButtons(Button* buttons, int startButtonIndex, int endButtonIndex, ButtonChangedHandlerBase& buttonChangedHandler);
+  // This method starts the pedal input, after the pedal pins are configured.
+  void Setup();
+
+  void ReadButtons(Button* buttons, int startButtonIndex, int endButtonIndex, PedalButtonChangedHandler& buttonChangedHandler);
+
+  // This method sets the lockout debounce time; it is DebounceDelayMs until set.
+  void SetDebounceDelayMs(uint8_t debounceDelayMs) { mDebounceDelayMs = debounceDelayMs; }
 
 protected:
   // The default constructor is protected to prevent its usage.
   ButtonsManager();
 
   // The following methods are only used by the RH Arduino.
+  // This method sets the remote pedal flags of a received bitmap byte; 7 pedals per byte, least significant first.
   void UpdateNewButtonFlags(uint8_t receivedByte, int index);
 
 private:
-  bool IsButtonDebounced(const Button& button);
+#ifndef DEBOUNCE_VERTICAL_COUNTER
+  bool IsButtonDebounced(const Button& button, unsigned long curTimeMs);
+#endif
+
+#if defined(SCAN_PEDAL_PORTS) || defined(READ_PEDALS_FROM_SHIFT_REGISTERS)
+  PedalFlags ReadPressedFlags();
+#endif
+
+  // This method handles the buttons whose pressed flags differ from the current button flags.
+  void UpdateButtons(Button* buttons, int startButtonIndex, int endButtonIndex, PedalFlags pressedFlags, PedalButtonChangedHandler& buttonChangedHandler, unsigned long curTimeMs);
+
+#if defined(CAPTURE_PEDAL_EDGES) || defined(SCHEDULE_PEDAL_SCANS)
+  // This method handles the pedal events captured since the last call, in the order they occurred.
+  void ReadCapturedButtons(Button* buttons, int startButtonIndex, int endButtonIndex, PedalButtonChangedHandler& buttonChangedHandler);
+#endif
+
+#ifdef SCAN_PEDAL_PORTS
+  PedalPortScanner mPedalPortScanner;
+#endif
+
+#ifdef READ_PEDALS_FROM_SHIFT_REGISTERS
+  ShiftRegisterPedalInput mShiftRegisterPedalInput;
+#endif
+
+#ifdef READ_LADDER_PEDALS
+  ResistorLadderPedalInput mResistorLadderPedalInput;
+#endif
+
+#ifdef DEBOUNCE_VERTICAL_COUNTER
+  VerticalCounterDebouncer mVerticalCounterDebouncer;
+#endif
+
+#ifdef ADAPTIVE_DEBOUNCE
+  AdaptiveDebounceTuner mAdaptiveDebounceTuner;
+#endif
+
+#ifdef RECEIVE_PEDAL_LINK
+  // This method updates the remote pedal flags from the pedal link frames received since the last call.
+  void ReadLinkedButtonFlags();
+
+  PedalLinkReceiver mPedalLinkReceiver;
+#endif
+
+#ifdef CAPTURE_PEDAL_EDGES
+  PedalEdgeCapture mPedalEdgeCapture;
+#endif
+
+#ifdef SCHEDULE_PEDAL_SCANS
+  PedalScanScheduler mPedalScanScheduler;
+#endif
+
+#if defined(CAPTURE_PEDAL_EDGES) || defined(SCHEDULE_PEDAL_SCANS)
+  // The pressed flags of the last captured pedal event, and the time, in milliseconds, of that event.
+  PedalFlags mCapturedPressedFlags = 0;
+  unsigned long mCapturedTimeMs = 0;
+
+  uint16_t mNumReportedCaptureOverflows = 0;
+#endif
 
 private:
-  uint16_t mNewFootSwitchesButtonFlags = 0;
+  // The remote pedal flags, starting at bit 0.
+  PedalFlags mNewFootSwitchesButtonFlags = 0;
 };
 
 #endif
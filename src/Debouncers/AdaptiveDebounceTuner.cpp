@@ -0,0 +1,196 @@
+/*******************************************************************************
+  AdaptiveDebounceTuner.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless tuning the debounce time.
+#ifdef ADAPTIVE_DEBOUNCE
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+
+#include "AdaptiveDebounceTuner.h"
+
+#include "../EepromLayout.h"
+#include "../SharedMacros.h"
+
+AdaptiveDebounceTuner::AdaptiveDebounceTuner()
+{
+}
+
+void AdaptiveDebounceTuner::Load(Button* buttons, int numButtons)
+{
+  bool isStored = EEPROM.read(EepromAdaptiveDebounceAddress) == EepromAdaptiveDebounceVersion;
+
+  for (int i = 0; i < numButtons; i++)
+  {
+    uint8_t bounceP99Ms = isStored ? EEPROM.read(EepromAdaptiveDebounceAddress + 1 + i) : 0xFF;
+    if (bounceP99Ms > DebounceDelayMs - AdaptiveDebounceMarginMs)
+    {
+      // Not stored, or invalid; start with the fixed debounce time.
+      bounceP99Ms = DebounceDelayMs - AdaptiveDebounceMarginMs;
+    }
+
+    buttons[i].buttonState.bounceP99Ms = bounceP99Ms;
+    buttons[i].buttonState.numBouncesAtP99 = 0;
+
+    DBG_PRINT_LN("AdaptiveDebounceTuner::Load() - buttonIndex = " + String(i) + "; debounce = " + String(GetDebounceDelayMs(buttons[i])) + " ms.");
+  }
+
+  if (!isStored)
+  {
+    // Save all estimates, then the version; an interrupted first save is not loaded.
+    mUnsavedFlags = (PedalFlags)(((PedalFlags)2 << (numButtons - 1)) - 1);
+    mFirstUnsavedTimeMs = millis();
+    mIsVersionUnsaved = true;
+  }
+}
+
+void AdaptiveDebounceTuner::OnScan(Button* buttons, PedalFlags rawPressedFlags, unsigned long curTimeMs)
+{
+  PedalFlags rawChangedFlags = rawPressedFlags ^ mLastRawPressedFlags;
+  mLastRawPressedFlags = rawPressedFlags;
+
+  PedalFlags observingFlags = mObservingFlags;
+  PedalFlags buttonFlag = 1;
+  for (byte i = 0; observingFlags != 0; i++, buttonFlag <<= 1)
+  {
+    if ((observingFlags & buttonFlag) == 0)
+    {
+      continue;
+    }
+
+    observingFlags &= ~buttonFlag;
+
+    unsigned long elapsedTimeMs = curTimeMs - buttons[i].lastToggleTimeMs;
+    if (elapsedTimeMs < BounceObservationWindowMs)
+    {
+      if (rawChangedFlags & buttonFlag)
+      {
+        buttons[i].buttonState.bounceTimeMs = elapsedTimeMs;
+      }
+
+      continue;
+    }
+
+    // The observation window ended; the pedal's last raw change was its bounce time.
+    mObservingFlags &= ~buttonFlag;
+    AddBounceTime(buttons[i], buttonFlag);
+  }
+
+  SaveNextEstimate(buttons, curTimeMs);
+}
+
+void AdaptiveDebounceTuner::OnButtonToggled(Button& button, PedalFlags buttonFlag)
+{
+  if (mObservingFlags & buttonFlag)
+  {
+    // Toggled within the observation window of its previous toggle; its raw change was recorded by OnScan() as a bounce.
+    AddBounceTime(button, buttonFlag);
+  }
+
+  button.buttonState.bounceTimeMs = 0;
+  mObservingFlags |= buttonFlag;
+}
+
+unsigned long AdaptiveDebounceTuner::GetDebounceDelayMs(const Button& button)
+{
+  unsigned long debounceDelayMs = button.buttonState.bounceP99Ms + AdaptiveDebounceMarginMs;
+
+  return constrain(debounceDelayMs, MinAdaptiveDebounceDelayMs, DebounceDelayMs);
+}
+
+void AdaptiveDebounceTuner::AddBounceTime(Button& button, PedalFlags buttonFlag)
+{
+  ButtonState& buttonState = button.buttonState;
+  uint8_t prevBounceP99Ms = buttonState.bounceP99Ms;
+
+  if (buttonState.bounceTimeMs > buttonState.bounceP99Ms)
+  {
+    // Raise the estimate to the longer bounce, up to the fixed debounce time.
+    buttonState.bounceP99Ms = min(buttonState.bounceTimeMs, DebounceDelayMs - AdaptiveDebounceMarginMs);
+    buttonState.numBouncesAtP99 = 0;
+  }
+  else if (++buttonState.numBouncesAtP99 >= NumBouncesPerP99Decrement)
+  {
+    if (buttonState.bounceP99Ms > 0)
+    {
+      buttonState.bounceP99Ms--;
+    }
+
+    buttonState.numBouncesAtP99 = 0;
+  }
+
+  if (buttonState.bounceP99Ms != prevBounceP99Ms)
+  {
+    if (mUnsavedFlags == 0)
+    {
+      mFirstUnsavedTimeMs = millis();
+    }
+
+    mUnsavedFlags |= buttonFlag;
+
+    DBG_PRINT_LN("AdaptiveDebounceTuner::AddBounceTime() - " + String(buttonState.pin) + ": bounceP99Ms = " + String(buttonState.bounceP99Ms) + "; debounce = " + String(GetDebounceDelayMs(button)) + " ms.");
+  }
+}
+
+void AdaptiveDebounceTuner::SaveNextEstimate(const Button* buttons, unsigned long curTimeMs)
+{
+  if (mUnsavedFlags == 0 && !mIsVersionUnsaved)
+  {
+    return;
+  }
+
+  // Wait, so a burst of changes is saved once.
+  if (curTimeMs - mFirstUnsavedTimeMs < AdaptiveDebounceSaveDelayMs)
+  {
+    return;
+  }
+
+  // An EEPROM write takes about 3.3 ms; only start one when the previous write has completed.
+  if (!eeprom_is_ready())
+  {
+    return;
+  }
+
+  PedalFlags buttonFlag = 1;
+  for (byte i = 0; mUnsavedFlags != 0; i++, buttonFlag <<= 1)
+  {
+    if (mUnsavedFlags & buttonFlag)
+    {
+      EEPROM.update(EepromAdaptiveDebounceAddress + 1 + i, buttons[i].buttonState.bounceP99Ms);
+      mUnsavedFlags &= ~buttonFlag;
+
+      return;
+    }
+  }
+
+  EEPROM.update(EepromAdaptiveDebounceAddress, EepromAdaptiveDebounceVersion);
+  mIsVersionUnsaved = false;
+}
+
+#endif // ADAPTIVE_DEBOUNCE
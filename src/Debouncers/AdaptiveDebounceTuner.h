@@ -0,0 +1,82 @@
+/*******************************************************************************
+  AdaptiveDebounceTuner.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef AdaptiveDebounceTuner_H
+#define AdaptiveDebounceTuner_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../Button.h"
+#include "../PedalFlags.h"
+#include "../SharedConstants.h"
+
+// This class tunes the lockout debounce time of each pedal from the bounce it measures during use.
+// After each accepted toggle, the pedal's raw state is observed for BounceObservationWindowMs; the time of its last raw change is its bounce time.
+// Each pedal keeps an estimate of its 99th percentile bounce time (bounceP99Ms): a longer bounce raises the estimate to it,
+// and every NumBouncesPerP99Decrement bounces at or below the estimate lower it by 1 ms.
+// A pedal's debounce time is its estimate plus AdaptiveDebounceMarginMs, from MinAdaptiveDebounceDelayMs to DebounceDelayMs.
+// The estimates are persisted in EEPROM, one byte at a time, so writing never stalls the pedal scan.
+class AdaptiveDebounceTuner {
+
+public:
+  // This method is the default constructor.
+  AdaptiveDebounceTuner();
+
+  // This method loads the bounce estimates from EEPROM, or starts at DebounceDelayMs if none are stored.
+  void Load(Button* buttons, int numButtons);
+
+  // This method observes the raw pressed flags of a scan, taken at curTimeMs. It must be called before handling the scan's changes.
+  void OnScan(Button* buttons, PedalFlags rawPressedFlags, unsigned long curTimeMs);
+
+  // This method starts observing the bounce of a button that was just toggled.
+  void OnButtonToggled(Button& button, PedalFlags buttonFlag);
+
+  // This method returns the debounce time of the button.
+  static unsigned long GetDebounceDelayMs(const Button& button);
+
+private:
+  // This method adds the observed bounce time to the button's 99th percentile estimate.
+  void AddBounceTime(Button& button, PedalFlags buttonFlag);
+
+  // This method writes at most one changed estimate to EEPROM, if EEPROM is ready.
+  void SaveNextEstimate(const Button* buttons, unsigned long curTimeMs);
+
+private:
+  PedalFlags mLastRawPressedFlags = 0;
+
+  // The buttons whose bounce is being observed.
+  PedalFlags mObservingFlags = 0;
+
+  // The buttons whose estimate changed since it was saved, and the time the first of them changed.
+  PedalFlags mUnsavedFlags = 0;
+  unsigned long mFirstUnsavedTimeMs = 0;
+
+  // Set when no estimates were stored; the version is saved after all estimates.
+  bool mIsVersionUnsaved = false;
+};
+
+#endif
@@ -0,0 +1,65 @@
+/*******************************************************************************
+  VerticalCounterDebouncer.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include <Arduino.h>
+
+#include "VerticalCounterDebouncer.h"
+
+#include "../SharedConstants.h"
+
+VerticalCounterDebouncer::VerticalCounterDebouncer()
+{
+}
+
+bool VerticalCounterDebouncer::IsSampleDue()
+{
+  uint8_t curTimeMs = (uint8_t)millis();
+
+  if ((uint8_t)(curTimeMs - mLastSampleTimeMs) < VerticalCounterSampleTickMs)
+  {
+    return false;
+  }
+
+  mLastSampleTimeMs = curTimeMs;
+
+  return true;
+}
+
+PedalFlags VerticalCounterDebouncer::Update(PedalFlags rawPressedFlags)
+{
+  // Pedals whose raw state differs from their debounced state.
+  PedalFlags differentFlags = rawPressedFlags ^ mDebouncedFlags;
+
+  // Count down the counters of differing pedals; reset the others to 3.
+  mCount0 = ~(mCount0 & differentFlags);
+  mCount1 = mCount0 ^ (mCount1 & differentFlags);
+
+  // A counter that rolled over from 0 to 3 while still differing toggles its pedal.
+  PedalFlags toggleFlags = differentFlags & mCount0 & mCount1;
+  mDebouncedFlags ^= toggleFlags;
+
+  return mDebouncedFlags;
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+  VerticalCounterDebouncer.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef VerticalCounterDebouncer_H
+#define VerticalCounterDebouncer_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../PedalFlags.h"
+
+// This class debounces all foot pedals at once, using a 2-bit vertical counter per pedal.
+// Bit N of mCount0 and mCount1 form the counter of pedal N, so one sample of every pedal is debounced with a few bitwise operations.
+// A pedal's debounced state toggles only after its raw state differs from the debounced state for four consecutive samples.
+// Samples are taken at a fixed tick of VerticalCounterSampleTickMs; therefore, a pedal must be stable for 4 * VerticalCounterSampleTickMs.
+class VerticalCounterDebouncer {
+
+public:
+  // This method is the default constructor.
+  VerticalCounterDebouncer();
+
+  // This method returns true, once per sample tick, when the next sample is due.
+  bool IsSampleDue();
+
+  // This method debounces one sample of the raw pressed flags, and returns the debounced pressed flags.
+  PedalFlags Update(PedalFlags rawPressedFlags);
+
+  // This method returns the debounced pressed flags of the last sample.
+  PedalFlags GetDebouncedFlags() const { return mDebouncedFlags; }
+
+private:
+  PedalFlags mDebouncedFlags = 0;
+
+  // The vertical counter bits. A counter is reset to 3 (both bits set) whenever the raw state matches the debounced state.
+  PedalFlags mCount0 = (PedalFlags)~0;
+  PedalFlags mCount1 = (PedalFlags)~0;
+
+  // The low byte of the last sample time, in milliseconds. The sample tick is short enough to compare in 8 bits.
+  uint8_t mLastSampleTimeMs = 0;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*******************************************************************************
+  EepromLayout.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef EepromLayout_H
+#define EepromLayout_H
+
+#include <avr/io.h>
+
+#include "MidiAccompanimentController.h"
+#include "PedalConfig.h"
+#include "PerformanceState.h"
+#include "SharedConstants.h"
+
+// This file contains the EEPROM addresses of all persisted data. Each block starts with a version byte,
+// which is changed whenever the block's format changes, so a stale block is ignored instead of misread.
+
+// Adaptive debounce: the version byte, followed by the bounceP99Ms of each foot pedal button.
+const int EepromAdaptiveDebounceAddress = 0;
+const uint8_t EepromAdaptiveDebounceVersion = 0xA1;
+const int EepromAdaptiveDebounceSize = 1 + NumFootPedalButtons;
+
+// Pedal configuration: the version byte, followed by the PedalConfig, and its CRC-16.
+// It is at a fixed address, so it is kept when the number of pedals, and the adaptive debounce block's size, change.
+const int EepromPedalConfigAddress = 64;
+const uint8_t EepromPedalConfigVersion = 0xB2;
+const int EepromPedalConfigSize = 1 + sizeof(PedalConfig) + 2;
+
+// Performance journal: NumPerformanceJournalRecords records of the PerformanceState, a sequence number, and a CRC-8.
+// It has no version byte; the version is included in each record's CRC.
+const int EepromPerformanceJournalAddress = 256;
+const uint8_t EepromPerformanceJournalVersion = 0xC1;
+const int EepromPerformanceJournalRecordSize = sizeof(PerformanceState) + 2;
+const int EepromPerformanceJournalSize = NumPerformanceJournalRecords * EepromPerformanceJournalRecordSize;
+
+static_assert(EepromAdaptiveDebounceAddress + EepromAdaptiveDebounceSize <= EepromPedalConfigAddress, "The adaptive debounce block overlaps the pedal configuration block.");
+static_assert(EepromPedalConfigAddress + EepromPedalConfigSize <= EepromPerformanceJournalAddress, "The pedal configuration block overlaps the performance journal.");
+static_assert(EepromPerformanceJournalAddress + EepromPerformanceJournalSize <= E2END + 1, "The performance journal does not fit in EEPROM.");
+
+#endif
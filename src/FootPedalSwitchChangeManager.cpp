@@ -24,61 +24,372 @@
   
  ******************************************************************************/
 
-// This file supports two pedal boards; one with 5 switches, and one with 8 switches (two rows of four pedals).
-// The Arduino pins are specified in main.cpp.
+// This file handles the pedals of the pedal boards, and the other pedal inputs that are built.
+// The pedal boards, their pins and their profiles are specified in PedalBoards.h.
 
 #include "lib/ArduMidi/ardumidi.h"
 
 #include "MidiAccompanimentController.h"
 #include "MIDIEventFlasher.h"
+#include "MidiTransmitQueue.h"
 #include "FootPedalSwitchChangeManager.h"
+#include "KeyboardProfiles/StyleCatalog.h"
+#include "PedalConfigStore.h"
 #include "SharedMacros.h"
 #include "SharedConstants.h"
 #include "StatusManager.h"
 #include "Utilities/Utilities.h"
 
-extern StatusManager gStatusManager;
 
-FootPedalSwitchChangeManager::FootPedalSwitchChangeManager()
-: mCurTempo(0)
+// The default pedal actions of each pedal board profile, used when EEPROM has no valid pedal configuration.
+// Remap a pedal by changing its descriptors; the pedal boards and their profiles are in PedalBoards.h.
+// The Section Control profile selects the current style's variation, and sends Ending 1; it sends switch on and off.
+const PedalActionDescriptor FootPedalSwitchChangeManager::SectionControlProfileActions[5][PedalEdge::NumPedalEdges] PROGMEM = {
+  {MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::MainA), MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::MainA)},
+  {MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::MainB), MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::MainB)},
+  {MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::MainC), MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::MainC)},
+  {MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::MainD), MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::MainD)},
+  {MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::Ending1), MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::Ending1)}
+};
+
+// The Style Select profile selects six styles, and steps the tempo with logical pedals 3 and 7, when pressed.
+const PedalActionDescriptor FootPedalSwitchChangeManager::StyleSelectProfileActions[8][PedalEdge::NumPedalEdges] PROGMEM = {
+  {MakeSelectStyleAction(StyleNum::BigBandSwing), MakePedalAction(PedalActionType::NoAction)},
+  {MakeSelectStyleAction(StyleNum::CoolBossa), MakePedalAction(PedalActionType::NoAction)},
+  {MakeSelectStyleAction(StyleNum::VocalWaltz), MakePedalAction(PedalActionType::NoAction)},
+  {MakePedalAction(PedalActionType::TempoUp), MakePedalAction(PedalActionType::NoAction)},
+  {MakeSelectStyleAction(StyleNum::BigBandBallad), MakePedalAction(PedalActionType::NoAction)},
+  {MakeSelectStyleAction(StyleNum::AcousticJazz), MakePedalAction(PedalActionType::NoAction)},
+  {MakeSelectStyleAction(StyleNum::BigBandJazz), MakePedalAction(PedalActionType::NoAction)},
+  {MakePedalAction(PedalActionType::TempoDown), MakePedalAction(PedalActionType::NoAction)}
+};
+
+// The registration banks 1 and up; bank 0 is the pedal configuration. Each bank assigns the Style Select profile's logical pedals,
+// whose tempo pedals are 3 and 7, and sets the default tempo.
+const RegistrationBank FootPedalSwitchChangeManager::RegistrationBanks[NumRegistrationBanks - 1] PROGMEM = {
+  // Pop.
+  {{MakeSelectStyleAction(StyleNum::SkyPop), MakeSelectStyleAction(StyleNum::UKSoftRock), MakeSelectStyleAction(StyleNum::PowerBallad), MakePedalAction(PedalActionType::TempoUp),
+    MakeSelectStyleAction(StyleNum::PianoBallad), MakeSelectStyleAction(StyleNum::ElectroPop), MakeSelectStyleAction(StyleNum::CountryPop), MakePedalAction(PedalActionType::TempoDown)}, 110},
+
+  // Country.
+  {{MakeSelectStyleAction(StyleNum::CountryFolk8Beat), MakeSelectStyleAction(StyleNum::CountryShuffle), MakeSelectStyleAction(StyleNum::NashvillePop), MakePedalAction(PedalActionType::TempoUp),
+    MakeSelectStyleAction(StyleNum::CountryBallad1), MakeSelectStyleAction(StyleNum::CountryRock), MakeSelectStyleAction(StyleNum::ModernPickin), MakePedalAction(PedalActionType::TempoDown)}, 100},
+
+  // Rock.
+  {{MakeSelectStyleAction(StyleNum::StadiumRock), MakeSelectStyleAction(StyleNum::PowerRock), MakeSelectStyleAction(StyleNum::StandardRock), MakePedalAction(PedalActionType::TempoUp),
+    MakeSelectStyleAction(StyleNum::OrchRockBallad1), MakeSelectStyleAction(StyleNum::AcousticRock), MakeSelectStyleAction(StyleNum::RockShuffleFast), MakePedalAction(PedalActionType::TempoDown)}, 126},
+
+  // Set list; the back row's first pedal selects the next song, and the front row's first pedal the previous song.
+  {{MakePedalAction(PedalActionType::NextSong), MakePedalAction(PedalActionType::NoAction), MakePedalAction(PedalActionType::NoAction), MakePedalAction(PedalActionType::TempoUp),
+    MakePedalAction(PedalActionType::PreviousSong), MakePedalAction(PedalActionType::NoAction), MakePedalAction(PedalActionType::NoAction), MakePedalAction(PedalActionType::TempoDown)}, 120}
+};
+
+// The set list, in performance order. Each song is {StyleNum, tempo, starting section}.
+const SetlistSong FootPedalSwitchChangeManager::Setlist[] PROGMEM = {
+  {StyleNum::BigBandSwing, 132, StyleSectionControlSwitchNum::Intro1},
+  {StyleNum::CoolBossa, 110, StyleSectionControlSwitchNum::MainA},
+  {StyleNum::VocalWaltz, 90, StyleSectionControlSwitchNum::Intro2},
+  {StyleNum::BigBandBallad, 70, StyleSectionControlSwitchNum::MainB},
+  {StyleNum::AcousticJazz, 120, StyleSectionControlSwitchNum::Intro1}
+};
+
+const uint8_t FootPedalSwitchChangeManager::NumSetlistSongs = COUNT_ENTRIES(Setlist);
+
+FootPedalSwitchChangeManager::FootPedalSwitchChangeManager(StatusManager& statusManager, MidiTransmitQueue& midiTransmitQueue)
+: mStatusManager(statusManager), mMidiTransmitQueue(midiTransmitQueue), mCurTempo(0)
 {
 }
 
+void FootPedalSwitchChangeManager::Setup()
+{
+#ifdef SEND_MIDI
+  LoadConfig();
+#else
+  unsigned long startTimeUs = micros();
+  bool isLoaded = LoadConfig();
+#endif
+
+  mBaseConfig = mPedalConfig;
+
+  // The first song's burst is ready before its pedal is pressed.
+  mNextSongBurstIndex = 0;
+  mNextSongBurstLength = EncodeSongBurst(0, mNextSongBurst);
+
+#ifndef SEND_MIDI
+  // Reading and checking the block takes well under a millisecond; it is measured here to keep it so.
+  unsigned long loadTimeUs = micros() - startTimeUs;
+  DBG_PRINT_LN("FootPedalSwitchChangeManager::Setup() - isLoaded = " + String(isLoaded) + "; loadTimeUs = " + String(loadTimeUs) + ".");
+#endif
+}
+
+bool FootPedalSwitchChangeManager::LoadConfig()
+{
+  bool isLoaded = PedalConfigStore::Load(mPedalConfig);
+  if (!isLoaded)
+  {
+    LoadDefaultConfig();
+  }
+
+  return isLoaded;
+}
+
+void FootPedalSwitchChangeManager::LoadDefaultConfig()
+{
+  uint8_t buttonIndex = 0;
+  for (uint8_t i = 0; i < NumPedalBoards; i++)
+  {
+    PedalBoardDescriptor pedalBoard = ReadPedalBoard(i);
+    for (uint8_t logicalPedal = 0; logicalPedal < pedalBoard.numPedals; logicalPedal++, buttonIndex++)
+    {
+      ReadProfilePedalActions(pedalBoard.profile, logicalPedal, mPedalConfig.pedalActions[buttonIndex]);
+    }
+  }
+
+  mPedalConfig.defaultTempo = DefaultTempo;
+  mPedalConfig.minTempo = MinTempo;
+  mPedalConfig.maxTempo = MaxTempo;
+  mPedalConfig.debounceDelayMs = DebounceDelayMs;
+}
+
+void FootPedalSwitchChangeManager::ApplyPedalConfig(const PedalConfig& pedalConfig)
+{
+  mBaseConfig = pedalConfig;
+  mPedalConfig = pedalConfig;
+  mActiveBankIndex = 0;
+}
+
+PerformanceState FootPedalSwitchChangeManager::GetPerformanceState() const
+{
+  return PerformanceState{mCurStyleNum, (uint8_t)mCurTempo, mCurSectionSwitchNum};
+}
+
+void FootPedalSwitchChangeManager::RestorePerformanceState(const PerformanceState& state)
+{
+  if (state.tempo >= mPedalConfig.minTempo && state.tempo <= mPedalConfig.maxTempo)
+  {
+    mCurTempo = state.tempo;
+  }
+
+  mCurStyleNum = state.styleNum;
+  mCurSectionSwitchNum = state.sectionSwitchNum;
+
+  DBG_PRINT_LN("FootPedalSwitchChangeManager::RestorePerformanceState() - mCurTempo = " + String(mCurTempo) + "; mCurStyleNum = " + String(mCurStyleNum) + ".");
+}
+
+void FootPedalSwitchChangeManager::ReadProfilePedalActions(uint8_t profile, uint8_t logicalPedal, PedalActionDescriptor* pedalActions)
+{
+  const PedalActionDescriptor (*profileActions)[PedalEdge::NumPedalEdges] = NULL;
+  uint8_t numProfilePedals;
+  switch (profile)
+  {
+    case PedalBoardProfile::SectionControlProfile:
+      profileActions = SectionControlProfileActions;
+      numProfilePedals = COUNT_ENTRIES(SectionControlProfileActions);
+      break;
+
+    case PedalBoardProfile::StyleSelectProfile:
+      profileActions = StyleSelectProfileActions;
+      numProfilePedals = COUNT_ENTRIES(StyleSelectProfileActions);
+      break;
+
+    default:
+      numProfilePedals = 0;
+      break;
+  }
+
+  if (logicalPedal >= numProfilePedals)
+  {
+    pedalActions[PedalEdge::PressEdge] = MakePedalAction(PedalActionType::NoAction);
+    pedalActions[PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::NoAction);
+    return;
+  }
+
+  memcpy_P(pedalActions, profileActions[logicalPedal], sizeof(profileActions[logicalPedal]));
+}
+
 void FootPedalSwitchChangeManager::HandleButtonChange(int buttonIndex, bool isActive)
 {
-  if (buttonIndex >=0 && buttonIndex <= 4)
+#ifdef RECEIVE_PEDAL_LINK
+  // The remote pedals act as the pedals at the same position on this board.
+  if (buttonIndex >= RemoteFirstPedalIndex)
   {
-    HandleFivePedalBoardSwitchChange(buttonIndex, isActive);
+    buttonIndex -= RemoteFirstPedalIndex;
   }
-  else if(buttonIndex >=5 && buttonIndex <= 13)
+#endif
+
+  PedalActionDescriptor action = ReadPedalAction(buttonIndex, isActive ? PedalEdge::PressEdge : PedalEdge::ReleaseEdge);
+
+  DBG_PRINT_LN("FootPedalSwitchChangeManager::HandleButtonChange() - buttonIndex = " + String(buttonIndex) + "; isActive = " + String(isActive) + "; action = " + String(action.type) + ".");
+
+  ExecutePedalAction(action);
+}
+
+// This method handles pedal gestures. A hold on a tempo pedal repeats its tempo change; other gestures are not used yet.
+void FootPedalSwitchChangeManager::HandleGesture(int buttonIndex, PedalGesture gesture)
+{
+  if (gesture != PedalGesture::Hold)
+  {
+    return;
+  }
+
+  PedalActionDescriptor action = ReadPedalAction(buttonIndex, PedalEdge::PressEdge);
+  if (action.type == PedalActionType::TempoUp || action.type == PedalActionType::TempoDown)
   {
-    HandleEightPedalBoardSwitchChange(buttonIndex, isActive);
+    ExecutePedalAction(action);
   }
 }
 
-// This method handles the 5-pedal board. The first four pedals select the current style's variation, and the 5th pedal sends Ending 1.
-void FootPedalSwitchChangeManager::HandleFivePedalBoardSwitchChange(int buttonIndex, bool isActive)
+// This method handles pedal combos.
+void FootPedalSwitchChangeManager::HandleCombo(PedalComboAction action)
 {
-  // Precondition buttonIndex within pedal range (e.g., 0..4).
-  if (buttonIndex < 0 || buttonIndex > 4)
+  switch (action)
+  {
+    case PedalComboAction::ResetTempo:
+      mCurTempo = mPedalConfig.defaultTempo;
+      SendTempoSysEx(mCurTempo);
+      break;
+
+    case PedalComboAction::SendEnding2:
+#ifdef SEND_MIDI
+      SendStyleSectionControlSysEx(StyleSectionControlSwitchNum::Ending2, true);
+      SendStyleSectionControlSysEx(StyleSectionControlSwitchNum::Ending2, false);
+#else
+      DBG_PRINT_LN("FootPedalSwitchChangeManager::HandleCombo() - Ending 2.");
+#endif
+      break;
+
+    case PedalComboAction::SelectNextBank:
+      SelectNextRegistrationBank();
+      break;
+  }
+}
+
+void FootPedalSwitchChangeManager::SelectNextRegistrationBank()
+{
+  mActiveBankIndex = (mActiveBankIndex + 1) % NumRegistrationBanks;
+  ApplyRegistrationBank();
+
+  // Bank N flashes N + 1 times; the flashes do not block the pedals.
+  mStatusManager.IndicateCount(mActiveBankIndex + 1);
+
+  DBG_PRINT_LN("FootPedalSwitchChangeManager::SelectNextRegistrationBank() - mActiveBankIndex = " + String(mActiveBankIndex) + ".");
+}
+
+// Bank 0 restores the pedal configuration, as loaded or last applied. Another bank replaces the press actions of the
+// Style Select boards' pedals, and the default tempo, in the RAM image; the other pedals keep their configured actions.
+void FootPedalSwitchChangeManager::ApplyRegistrationBank()
+{
+  mPedalConfig = mBaseConfig;
+  if (mActiveBankIndex == 0)
   {
     return;
   }
 
+  RegistrationBank bank;
+  memcpy_P(&bank, &RegistrationBanks[mActiveBankIndex - 1], sizeof(RegistrationBank));
+
+  uint8_t buttonIndex = 0;
+  for (uint8_t i = 0; i < NumPedalBoards; i++)
+  {
+    PedalBoardDescriptor pedalBoard = ReadPedalBoard(i);
+    if (pedalBoard.profile == PedalBoardProfile::StyleSelectProfile)
+    {
+      for (uint8_t logicalPedal = 0; logicalPedal < pedalBoard.numPedals && logicalPedal < NumRegistrationBankPedals; logicalPedal++)
+      {
+        mPedalConfig.pedalActions[buttonIndex + logicalPedal][PedalEdge::PressEdge] = bank.pedalActions[logicalPedal];
+        mPedalConfig.pedalActions[buttonIndex + logicalPedal][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::NoAction);
+      }
+    }
+
+    buttonIndex += pedalBoard.numPedals;
+  }
+
+  // The bank's tempo is kept within the configured limits, which may have been narrowed since the banks were written.
+  mPedalConfig.defaultTempo = constrain(bank.defaultTempo, mPedalConfig.minTempo, mPedalConfig.maxTempo);
+}
+
+#ifdef READ_EXPRESSION_PEDAL
+// This method sends the expression pedal value to the accompaniment channels.
+void FootPedalSwitchChangeManager::HandleExpressionChange(uint8_t value)
+{
 #ifdef SEND_MIDI
-  // Index -> Switch
-  const StyleSectionControlSwitchNum switchNum[NumFootPedalButtons] = {StyleSectionControlSwitchNum::MainA, StyleSectionControlSwitchNum::MainB, StyleSectionControlSwitchNum::MainC, StyleSectionControlSwitchNum::MainD, StyleSectionControlSwitchNum::Ending1};
+  uint8_t controlChangeBytes[] = {MIDI_CONTROLLER_CHANGE | BassNotesZeroBasedMidiChannel, ExpressionControlNumber, value};
+  mMidiTransmitQueue.Send(MidiMessagePriority::ControlMessagePriority, controlChangeBytes, sizeof(controlChangeBytes));
 
-  SendStyleSectionControlSysEx(switchNum[buttonIndex], isActive);
+  controlChangeBytes[0] = MIDI_CONTROLLER_CHANGE | ChordsZeroBasedMidiChannel;
+  mMidiTransmitQueue.Send(MidiMessagePriority::ControlMessagePriority, controlChangeBytes, sizeof(controlChangeBytes));
 #else
-  DBG_PRINT_LN("FootPedalSwitchChangeManager::HandleFivePedalBoardSwitchChange() - buttonIndex = " + String(buttonIndex) + "; isActive = " + String(isActive) + ".");
+  DBG_PRINT_LN("FootPedalSwitchChangeManager::HandleExpressionChange() - value = " + String(value) + ".");
 #endif
 }
+#endif
+
+void FootPedalSwitchChangeManager::SelectSong(uint8_t songIndex)
+{
+  if (songIndex != mNextSongBurstIndex)
+  {
+    // The previous song, or the same song again; its burst is not precomputed.
+    mNextSongBurstIndex = songIndex;
+    mNextSongBurstLength = EncodeSongBurst(songIndex, mNextSongBurst);
+  }
+
+  // The burst is queued as one message, so no other message is sent between its messages. It is queued in the highest class,
+  // so the pedals pressed after it are sent after it, and it drops the queued tempo, style and Main section messages, which would override it.
+#ifdef SEND_MIDI
+  mMidiTransmitQueue.Send(MidiMessagePriority::SectionMessagePriority, mNextSongBurst, mNextSongBurstLength, MidiMessageKey::SongBurstMessageKey);
+#else
+  DBG_PRINT_LN("FootPedalSwitchChangeManager::SelectSong() - songIndex = " + String(songIndex) + "; burstLength = " + String(mNextSongBurstLength) + ".");
+#endif
+
+  mCurSongIndex = songIndex;
+  mCurTempo = pgm_read_byte(&Setlist[songIndex].tempo);
+  mCurStyleNum = pgm_read_word(&Setlist[songIndex].styleNum);
+  mCurSectionSwitchNum = pgm_read_byte(&Setlist[songIndex].sectionSwitchNum);
+
+  // Precompute the next song's burst, while the current one is being sent.
+  uint8_t nextSongIndex = min(songIndex + 1, NumSetlistSongs - 1);
+  if (nextSongIndex != songIndex)
+  {
+    mNextSongBurstIndex = nextSongIndex;
+    mNextSongBurstLength = EncodeSongBurst(nextSongIndex, mNextSongBurst);
+  }
+}
+
+uint8_t FootPedalSwitchChangeManager::EncodeSongBurst(uint8_t songIndex, uint8_t* sysExBytes)
+{
+  SetlistSong song;
+  memcpy_P(&song, &Setlist[songIndex], sizeof(SetlistSong));
+
+  uint8_t numBytes = EncodeStyleNumSysEx(song.styleNum, sysExBytes);
+  numBytes += EncodeTempoSysEx(song.tempo, sysExBytes + numBytes);
+  numBytes += EncodeStyleSectionControlSysEx((StyleSectionControlSwitchNum)song.sectionSwitchNum, true, sysExBytes + numBytes);
+  numBytes += EncodeStyleSectionControlSysEx((StyleSectionControlSwitchNum)song.sectionSwitchNum, false, sysExBytes + numBytes);
+  return numBytes;
+}
 
 void FootPedalSwitchChangeManager::SendStyleSectionControlSysEx(StyleSectionControlSwitchNum switchNum, bool isSwitchOn)
 {
-  // Send Yamaha SX-700/900 Section Control SysEx based on which switch is pressed.
-    // Send SysEx
+  if (isSwitchOn)
+  {
+    mCurSectionSwitchNum = switchNum;
+  }
+
+  // Only the last Main section pressed selects the variation, so a queued Main section press is superseded by a newer one.
+  // Each Main section has its own keys, so a release is dropped only with its own press.
+  MidiMessageKey key = MidiMessageKey::NoMessageKey;
+  if (switchNum >= StyleSectionControlSwitchNum::MainA && switchNum <= StyleSectionControlSwitchNum::MainD)
+  {
+    key = (MidiMessageKey)((isSwitchOn ? MidiMessageKey::MainSectionOnMessageKey : MidiMessageKey::MainSectionOffMessageKey) + (switchNum - StyleSectionControlSwitchNum::MainA));
+  }
+
+  uint8_t sysExBytes[StyleSectionControlSysExLength];
+  mMidiTransmitQueue.Send(MidiMessagePriority::SectionMessagePriority, sysExBytes, EncodeStyleSectionControlSysEx(switchNum, isSwitchOn, sysExBytes), key);
+}
+
+uint8_t FootPedalSwitchChangeManager::EncodeStyleSectionControlSysEx(StyleSectionControlSwitchNum switchNum, bool isSwitchOn, uint8_t* sysExBytes)
+{
+  // Encode the keyboard profile's Section Control SysEx based on which switch is pressed.
+    // Send SysEx, e.g., for the Yamaha arrangers,
     //  F0 43 7E 00 ss dd F7
     // ss = Switch Number
     // 00H INTRO 1
@@ -105,121 +416,158 @@ void FootPedalSwitchChangeManager::SendStyleSectionControlSysEx(StyleSectionCont
 
     // F7 = End of Exclusive
 
-    Serial.write(0xF0); // Exclusive status
-    Serial.write(0x43); // YAMAHA ID
-    Serial.write(0x7E); // Style
-    Serial.write(0x00);
+    memcpy_P(sysExBytes, KeyboardSectionControlSysExTemplate, StyleSectionControlSysExLength);
 
     const unsigned char SwitchOn = 0x7F; // Indicates front-panel switch is pressed.
     const unsigned char SwitchOff = 0x00; // Indicates front-panel switch is released.
     unsigned char switchOnOffByte =  isSwitchOn ? SwitchOn : SwitchOff;
-    Serial.write(switchNum); // Switch No.
-    Serial.write(switchOnOffByte); // Switch On/Off.
-    Serial.write(0xF7); // End of Exclusive
+    sysExBytes[KeyboardSectionSwitchNumIndex] = switchNum; // Switch No.
+    sysExBytes[KeyboardSectionSwitchNumIndex + 1] = switchOnOffByte; // Switch On/Off.
+
+    return StyleSectionControlSysExLength;
 }
 
-// The 8-pedal board has two rows of four pedals. The left 6 pedals choose 6 different styles. The two right pedals increment, decrement the tempos.
-void FootPedalSwitchChangeManager::HandleEightPedalBoardSwitchChange(int buttonIndex, bool isActive)
+// This method returns the pedal's action descriptor for the edge; one indexed read from the RAM image.
+PedalActionDescriptor FootPedalSwitchChangeManager::ReadPedalAction(int buttonIndex, PedalEdge edge)
 {
-  // Send style change only if changed to active.
-  if (!isActive)
+  if (buttonIndex < 0 || buttonIndex >= NumConfigurablePedals)
   {
-    return;
+    return MakePedalAction(PedalActionType::NoAction);
   }
 
-  // Precondition buttonIndex within pedal range (e.g., 5..12).
-  if (buttonIndex < 5 || buttonIndex > 12)
+  return mPedalConfig.pedalActions[buttonIndex][edge];
+}
+
+void FootPedalSwitchChangeManager::ExecutePedalAction(const PedalActionDescriptor& action)
+{
+  switch (action.type)
   {
-    return;
-  }
+#ifdef SEND_MIDI
+    // When debugging, the section switches are only logged, by HandleButtonChange().
+    case PedalActionType::SectionSwitchOn:
+      SendStyleSectionControlSysEx((StyleSectionControlSwitchNum)action.param0, true);
+      break;
+
+    case PedalActionType::SectionSwitchOff:
+      SendStyleSectionControlSysEx((StyleSectionControlSwitchNum)action.param0, false);
+      break;
+#endif
 
-  // Button Index Layout.
-  // 05 06 07 08
-  // 09 10 12 11 
+    case PedalActionType::SelectStyle:
+      SendStyleNumSysEx(((uint16_t)action.param0 << 8) | action.param1);
+      break;
 
-  int pedalIndex = buttonIndex - 5;
-  // Pedal Index Layout - Zero-based.
-  // 00 01 02 03
-  // 04 05 06 07
+    case PedalActionType::TempoUp:
+      StepTempo(true);
+      break;
 
-  // TODO: Implement tempo change on pedal index 3 and 7.
-  // mCurTempo = 0;
-  if (pedalIndex == 3)
-  {
-    if (mCurTempo == 0)
-    {
-      mCurTempo = DefaultTempo;
-    }
-    else
-    {
-      if (mCurTempo < MaxTempo)
-      {
-        mCurTempo++;
-      }
-    }
+    case PedalActionType::TempoDown:
+      StepTempo(false);
+      break;
 
-    SendTempoSysEx(mCurTempo);
+    case PedalActionType::NextRegistrationBank:
+      SelectNextRegistrationBank();
+      break;
 
-    return;
+    // The set list does not wrap; past either end, the end song is selected again.
+    case PedalActionType::NextSong:
+      SelectSong(mCurSongIndex == NoSongIndex ? 0 : min(mCurSongIndex + 1, NumSetlistSongs - 1));
+      break;
+
+    case PedalActionType::PreviousSong:
+      SelectSong(mCurSongIndex == NoSongIndex || mCurSongIndex == 0 ? 0 : mCurSongIndex - 1);
+      break;
+
+    default:
+      break;
+  }
+}
+
+// This method increments or decrements the tempo by one, within the configured tempo limits, and sends it.
+// The first tempo change sets the configured default tempo.
+void FootPedalSwitchChangeManager::StepTempo(bool isIncrement)
+{
+  if (mCurTempo == 0)
+  {
+    mCurTempo = mPedalConfig.defaultTempo;
   }
-  else if (pedalIndex == 7)
-  {    
-    if (mCurTempo == 0)
+  else if (isIncrement)
+  {
+    if (mCurTempo < mPedalConfig.maxTempo)
     {
-      mCurTempo = DefaultTempo;
+      mCurTempo++;
     }
-    else
+  }
+  else
+  {
+    if (mCurTempo > mPedalConfig.minTempo)
     {
-      if (mCurTempo > MinTempo)
-      {
-        mCurTempo--;
-      }
+      mCurTempo--;
     }
-    
-    SendTempoSysEx(mCurTempo);
-
-    return;
   }
 
-  // Set style based on pedal index.
-  uint16_t styleNum[] = { StyleNum::BigBandSwing, StyleNum::CoolBossa, StyleNum::VocalWaltz, StyleNum::Default,
-                          StyleNum::BigBandBallad, StyleNum::AcousticJazz, StyleNum::BigBandJazz, StyleNum::Default };
+  SendTempoSysEx(mCurTempo);
+}
 
-  SendStyleNumSysEx(styleNum[pedalIndex]);
+void FootPedalSwitchChangeManager::SendStyleNumSysEx(uint16_t styleNum)
+{
+  mCurStyleNum = styleNum;
+
+  uint8_t sysExBytes[StyleNumSysExLength];
+  EncodeStyleNumSysEx(styleNum, sysExBytes);
 
 #ifdef SEND_MIDI
+  mMidiTransmitQueue.Send(MidiMessagePriority::StyleMessagePriority, sysExBytes, StyleNumSysExLength, MidiMessageKey::StyleMessageKey);
 #else
-    DBG_PRINT_LN("FootPedalSwitchChangeManager::HandleRegistrationButtonChange() - buttonIndex = "  + String(buttonIndex) + "; isActive = " + String(isActive) + ".");
+  DBG_PRINT_LN("FootPedalSwitchChangeManager::SetStyle() - MSB = 0x" + String(sysExBytes[KeyboardStyleSelectMsbIndex], HEX) + "; LSB = 0x" + String(sysExBytes[KeyboardStyleSelectMsbIndex + 1], HEX) + ".");
+#ifdef KEYBOARD_PSR_SX900
+  uint16_t entryIndex = FindCatalogStyle(styleNum);
+  if (entryIndex != NoCatalogEntryIndex)
+  {
+    char styleName[24];
+    ReadCatalogStyleName(entryIndex, styleName, sizeof(styleName) - 1);
+    DBG_PRINT_LN("FootPedalSwitchChangeManager::SetStyle() - " + String(styleName) + " (" + String(GetCatalogCategoryName(GetCatalogStyleCategoryIndex(entryIndex))) + ").");
+  }
+#endif // KEYBOARD_PSR_SX900
 #endif
 }
 
-void FootPedalSwitchChangeManager::SendStyleNumSysEx(uint16_t styleNum)
+uint8_t FootPedalSwitchChangeManager::EncodeStyleNumSysEx(uint16_t styleNum, uint8_t* sysExBytes)
 {
+  // The keyboard profile's style select SysEx, e.g., for the PSR-SX900,
   // F0 43 73 01 51 05 00 03 04 00 00 dd dd F7
   // where dd dd is the MSB/LSB of the style number.
-  uint8_t styleNumMsb = (uint8_t)((styleNum & 0xFF00) >> 8);
-  uint8_t styleNumLsb = (uint8_t)(styleNum & 0x00FF);
-  uint8_t sysExBytes[] = {0xF0, 0x43, 0x73, 0x01, 0x51, 0x05, 0x00, 0x03, 0x04, 0x00, 0x00, 0xdd, 0xdd, 0xF7};
+  memcpy_P(sysExBytes, KeyboardStyleSelectSysExTemplate, StyleNumSysExLength);
 
-  sysExBytes[11] = styleNumMsb;
-  sysExBytes[12] = styleNumLsb;
+  sysExBytes[KeyboardStyleSelectMsbIndex] = (uint8_t)((styleNum & 0xFF00) >> 8);
+  sysExBytes[KeyboardStyleSelectMsbIndex + 1] = (uint8_t)(styleNum & 0x00FF);
 
-#ifdef SEND_MIDI
+  return StyleNumSysExLength;
+}
 
-  for (unsigned int i = 0; i < sizeof(sysExBytes); i++)
-  {
-    Serial.write(sysExBytes[i]);
-  }
+// Sends the encoded four bytes for the Yamaha tempo change SysEx message.
+void FootPedalSwitchChangeManager::SendTempoSysEx(uint16_t tempo)
+{
+  uint8_t sysExBytes[TempoSysExLength];
+  EncodeTempoSysEx(tempo, sysExBytes);
 
+#ifdef SEND_MIDI
+  mMidiTransmitQueue.Send(MidiMessagePriority::TempoMessagePriority, sysExBytes, TempoSysExLength, MidiMessageKey::TempoMessageKey);
 #else
-  DBG_PRINT_LN("FootPedalSwitchChangeManager::SetStyle() - MSB = 0x" + String(sysExBytes[11], HEX) + "; LSB = 0x" + String(sysExBytes[12], HEX) + ".");
+  DBG_PRINT("FootPedalSwitchChangeManager::SendTempoSysEx(" + String(tempo) + " = 0x" + String(tempo, HEX) + ")");
+  DBG_PRINT_LN(" - t4 = B"  + PrependZeros(String(sysExBytes[KeyboardTempoFirstByteIndex], BIN), 7) 
+  + " t3 = B"  + PrependZeros(String(sysExBytes[KeyboardTempoFirstByteIndex + 1], BIN), 7) 
+  + " t2 = B"  + PrependZeros(String(sysExBytes[KeyboardTempoFirstByteIndex + 2], BIN), 7) 
+  + " t1 = B"  + PrependZeros(String(sysExBytes[KeyboardTempoFirstByteIndex + 3], BIN), 7) 
+  + ".");
 #endif
 }
 
-// Sends the encoded four bytes for the Yamaha tempo change SysEx message.
+// Encodes the four tempo bytes of the keyboard profile's tempo change SysEx message.
 // Based on https://www.psrtutorial.com/forum/index.php?topic=48303.0
-void FootPedalSwitchChangeManager::SendTempoSysEx(uint16_t tempo)
+uint8_t FootPedalSwitchChangeManager::EncodeTempoSysEx(uint16_t tempo, uint8_t* sysExBytes)
 {
+  // The Yamaha arrangers' tempo SysEx is
   // F0 43 7E 01 t4 t3 t2 t1 F7
   // 11110000 F0 = Exclusive status 
   // 01000011 43 = YAMAHA ID 
@@ -248,25 +596,13 @@ void FootPedalSwitchChangeManager::SendTempoSysEx(uint16_t tempo)
   //---------- tempo sysEx
   //return [hex(0xF0), hex(0x43), hex(0x7E), hex(0x1), hex(t4), hex(t3), hex(t2), hex(t1), hex(0xF7)].join(" ");
 
-#ifdef SEND_MIDI
-  Serial.write(0xF0); // Exclusive status
-  Serial.write(0x43); // YAMAHA ID
-  Serial.write(0x7E); // Style
-  Serial.write(0x01);
-  Serial.write(t4);
-  Serial.write(t3);
-  Serial.write(t2);
-  Serial.write(t1);
-  Serial.write(0xF7);
-#else
-  DBG_PRINT("FootPedalSwitchChangeManager::SendTempoSysEx(" + String(tempo) + " = 0x" + String(tempo, HEX) + ") - totalTempo = " + String(totalTempo));
-  DBG_PRINT(" = B" + PrependZeros(String(totalTempo, BIN), 32));
-  DBG_PRINT_LN(" - t4 = B"  + PrependZeros(String(t4, BIN), 7) 
-  + " t3 = B"  + PrependZeros(String(t3, BIN), 7) 
-  + " t2 = B"  + PrependZeros(String(t2, BIN), 7) 
-  + " t1 = B"  + PrependZeros(String(t1, BIN), 7) 
-  + ".");
-#endif
+  memcpy_P(sysExBytes, KeyboardTempoSysExTemplate, TempoSysExLength);
+  sysExBytes[KeyboardTempoFirstByteIndex] = t4;
+  sysExBytes[KeyboardTempoFirstByteIndex + 1] = t3;
+  sysExBytes[KeyboardTempoFirstByteIndex + 2] = t2;
+  sysExBytes[KeyboardTempoFirstByteIndex + 3] = t1;
+
+  return TempoSysExLength;
 }
 
 // Prepend string with zeros up to numCharsWide long.
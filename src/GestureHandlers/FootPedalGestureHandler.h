@@ -0,0 +1,53 @@
+/*******************************************************************************
+  FootPedalGestureHandler.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef FootPedalGestureHandler_H
+#define FootPedalGestureHandler_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+
+#include "GestureHandlerBase.h"
+
+class FootPedalSwitchChangeManager;
+
+// This class handles foot pedal gestures, by forwarding them to the Foot Pedal Switch Change Manager passed to the constructor.
+class FootPedalGestureHandler : public GestureHandlerBase<FootPedalGestureHandler>
+{
+  friend class GestureHandlerBase<FootPedalGestureHandler>;
+
+public:
+  FootPedalGestureHandler(FootPedalSwitchChangeManager& footPedalSwitchChangeManager);
+
+private:
+  void HandleGestureImpl(byte buttonIndex, PedalGesture gesture);
+
+private:
+  FootPedalSwitchChangeManager& mFootPedalSwitchChangeManager;
+};
+
+#endif
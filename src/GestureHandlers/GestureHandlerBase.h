@@ -0,0 +1,53 @@
+/*******************************************************************************
+  GestureHandlerBase.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+#ifndef GestureHandlerBase_H
+#define GestureHandlerBase_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../PedalGesture.h"
+
+// This class template provides an interface to handle pedal gestures.
+// TDerived implements HandleGestureImpl(); the call is bound at compile time, so there is no virtual call.
+template <class TDerived>
+class GestureHandlerBase
+{ 
+public:
+  // This method handles a gesture of pedal buttonIndex.
+  void HandleGesture(byte buttonIndex, PedalGesture gesture)
+  {
+    static_cast<TDerived*>(this)->HandleGestureImpl(buttonIndex, gesture);
+  }
+
+protected:
+  // The constructor is protected; this class is only used as a base class.
+  GestureHandlerBase() {}
+};
+
+#endif
@@ -0,0 +1,245 @@
+/*******************************************************************************
+  IdleSleepManager.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "MidiAccompanimentController.h"
+
+// Do not build unless sleeping when idle.
+#ifdef SLEEP_WHEN_IDLE
+
+#include <Arduino.h>
+#include <avr/eeprom.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+
+#include "IdleSleepManager.h"
+#include "SharedConstants.h"
+#include "SharedMacros.h"
+#include "MidiTransmitQueue.h"
+#include "PerformanceJournal.h"
+#include "StatusManager.h"
+
+#ifdef DETECT_PEDAL_GESTURES
+  #include "PedalGestureEngine.h"
+#endif
+
+#ifdef DETECT_PEDAL_COMBOS
+  #include "PedalComboResolver.h"
+#endif
+
+// The quiet period must outlast every pending millis() based action, so that none is pending when it elapses.
+static_assert(IdleSleepDelayMs > DebounceDelayMs, "IdleSleepDelayMs must be greater than DebounceDelayMs.");
+static_assert(IdleSleepDelayMs > MidiEventFlashDurationMilliseconds, "IdleSleepDelayMs must be greater than MidiEventFlashDurationMilliseconds.");
+
+// The pin change interrupts of all three ports.
+static const uint8_t AllPinChangeInterrupts = bit(PCIE0) | bit(PCIE1) | bit(PCIE2);
+
+volatile unsigned long IdleSleepManager::sWakeTimeUs = 0;
+volatile bool IdleSleepManager::sIsWakeLatencyPending = false;
+
+IdleSleepManager::IdleSleepManager(StatusManager& statusManager, MidiTransmitQueue& midiTransmitQueue, PerformanceJournal& performanceJournal
+#ifdef DETECT_PEDAL_GESTURES
+  , PedalGestureEngine& pedalGestureEngine
+#endif
+#ifdef DETECT_PEDAL_COMBOS
+  , PedalComboResolver& pedalComboResolver
+#endif
+  ) :
+  mStatusManager(statusManager),
+  mMidiTransmitQueue(midiTransmitQueue),
+  mPerformanceJournal(performanceJournal)
+#ifdef DETECT_PEDAL_GESTURES
+  , mPedalGestureEngine(pedalGestureEngine)
+#endif
+#ifdef DETECT_PEDAL_COMBOS
+  , mPedalComboResolver(pedalComboResolver)
+#endif
+{
+}
+
+void IdleSleepManager::Setup(const Button* buttons, int numButtons)
+{
+  mButtons = buttons;
+  mNumButtons = numButtons;
+
+  for (int i = 0; i < numButtons; i++)
+  {
+    uint8_t pin = buttons[i].buttonState.pin;
+    *digitalPinToPCMSK(pin) |= bit(digitalPinToPCMSKbit(pin));
+  }
+}
+
+void IdleSleepManager::OnPedalChange()
+{
+  mLastPedalChangeTimeMs = millis();
+
+  bool isWakeLatencyPending;
+  unsigned long wakeTimeUs;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    isWakeLatencyPending = sIsWakeLatencyPending;
+    wakeTimeUs = sWakeTimeUs;
+    sIsWakeLatencyPending = false;
+  }
+
+  if (!isWakeLatencyPending)
+  {
+    return;
+  }
+
+  unsigned long wakeLatencyUs = micros() - wakeTimeUs;
+  if (wakeLatencyUs > mMaxWakeLatencyUs)
+  {
+    mMaxWakeLatencyUs = wakeLatencyUs;
+    DBG_PRINT_LN("IdleSleepManager::OnPedalChange() - Max wake latency = " + String(mMaxWakeLatencyUs) + " us.");
+  }
+}
+
+void IdleSleepManager::Update()
+{
+  // Unsigned subtraction is correct across the millis() rollover.
+  if (millis() - mLastPedalChangeTimeMs < IdleSleepDelayMs)
+  {
+    return;
+  }
+
+  if (!IsIdle())
+  {
+    return;
+  }
+
+  Sleep();
+}
+
+bool IdleSleepManager::IsIdle()
+{
+  if (!mStatusManager.IsStatusIndicatorIdle())
+  {
+    return false;
+  }
+
+#ifdef DETECT_PEDAL_GESTURES
+  if (!mPedalGestureEngine.IsIdle())
+  {
+    return false;
+  }
+#endif
+
+#ifdef DETECT_PEDAL_COMBOS
+  if (!mPedalComboResolver.IsIdle())
+  {
+    return false;
+  }
+#endif
+
+  // The queued MIDI messages must be sent before sleeping; the UART stops while asleep.
+  if (!mMidiTransmitQueue.IsIdle())
+  {
+    return false;
+  }
+
+  // A performance journal record must be written before sleeping, or it is only written after waking.
+  if (!mPerformanceJournal.IsIdle())
+  {
+    return false;
+  }
+
+  // An EEPROM write, e.g., of an adaptive debounce estimate, must complete first.
+  return eeprom_is_ready();
+}
+
+bool IdleSleepManager::ArePedalsSettled()
+{
+  for (int i = 0; i < mNumButtons; i++)
+  {
+    // Note: Input pin is pulled high; therefore logic is inverted.
+    bool isPressed = digitalRead(mButtons[i].buttonState.pin) == LOW;
+    if (isPressed != mButtons[i].buttonState.active)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void IdleSleepManager::Sleep()
+{
+  DBG_PRINT_LN("IdleSleepManager::Sleep() - Sleeping.");
+
+  // Let the UART finish sending; it stops in power-down.
+  Serial.flush();
+
+  set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+
+  cli();
+
+  // Clear stale pin changes, then check the pins; a pedal that changes after this sets the flag again, and wakes immediately.
+  PCIFR = AllPinChangeInterrupts;
+  if (!ArePedalsSettled())
+  {
+    // A pedal changed since the last scan; let ReadButtons() handle it first.
+    sei();
+    return;
+  }
+
+  PCICR |= AllPinChangeInterrupts;
+
+  sleep_enable();
+  sleep_bod_disable();
+
+  // The instruction after sei() is executed before any interrupt; therefore, a wake interrupt cannot be missed before sleep_cpu().
+  sei();
+  sleep_cpu();
+  sleep_disable();
+}
+
+// This method is called with interrupts disabled.
+void IdleSleepManager::OnWake()
+{
+  PCICR &= ~AllPinChangeInterrupts;
+
+  sWakeTimeUs = micros();
+  sIsWakeLatencyPending = true;
+}
+
+// The pedal pins are on all three ports; every port's pin change interrupt wakes the controller.
+ISR(PCINT0_vect)
+{
+  IdleSleepManager::OnWake();
+}
+
+ISR(PCINT1_vect)
+{
+  IdleSleepManager::OnWake();
+}
+
+ISR(PCINT2_vect)
+{
+  IdleSleepManager::OnWake();
+}
+
+#endif // SLEEP_WHEN_IDLE
@@ -0,0 +1,110 @@
+/*******************************************************************************
+  IdleSleepManager.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef IdleSleepManager_H
+#define IdleSleepManager_H
+
+#include <Arduino.h>
+
+#include "MidiAccompanimentController.h"
+
+#include "Button.h"
+
+class StatusManager;
+class MidiTransmitQueue;
+class PerformanceJournal;
+class PedalGestureEngine;
+class PedalComboResolver;
+
+// This class puts the ATmega into power-down sleep after IdleSleepDelayMs without pedal changes, and wakes it with a pin change on any pedal pin.
+// The pedal that wakes it is then read by the next ReadButtons(), and handled as a normal pedal change.
+// Timer0 stops while asleep; therefore, millis() does not advance, and every millis() based time (debounce, LED flash, gestures)
+// simply resumes after waking. It only sleeps when none of them is pending, so their durations are not stretched.
+// The wake latency is measured from the wake ISR until the wake pedal's MIDI bytes are queued; the oscillator start-up time
+// (16K clock cycles, about 1 ms, with the Uno fuses) precedes the ISR, and is not included.
+class IdleSleepManager {
+
+public:
+  // This method is the constructor. The controller only sleeps while the stages passed in are idle.
+  IdleSleepManager(StatusManager& statusManager, MidiTransmitQueue& midiTransmitQueue, PerformanceJournal& performanceJournal
+#ifdef DETECT_PEDAL_GESTURES
+    , PedalGestureEngine& pedalGestureEngine
+#endif
+#ifdef DETECT_PEDAL_COMBOS
+    , PedalComboResolver& pedalComboResolver
+#endif
+    );
+
+  // This method enables pin change detection on the pins of the buttons passed in. The pin change interrupts are only enabled while asleep.
+  void Setup(const Button* buttons, int numButtons);
+
+  // This method must be called after a pedal change is handled. It restarts the quiet period, and measures the wake latency.
+  void OnPedalChange();
+
+  // This method must be called from loop(). It sleeps if the quiet period has elapsed and the controller is idle, and returns after waking.
+  void Update();
+
+  // This method returns the largest measured wake latency, in microseconds.
+  unsigned long GetMaxWakeLatencyUs() const { return mMaxWakeLatencyUs; }
+
+  // This method is called by the pin change ISRs.
+  static void OnWake();
+
+private:
+  // This method returns true if no pending work depends on millis() or the UART.
+  bool IsIdle();
+
+  // This method returns true if every pedal pin matches its button state.
+  bool ArePedalsSettled();
+
+  void Sleep();
+
+private:
+  StatusManager& mStatusManager;
+  MidiTransmitQueue& mMidiTransmitQueue;
+  PerformanceJournal& mPerformanceJournal;
+
+#ifdef DETECT_PEDAL_GESTURES
+  PedalGestureEngine& mPedalGestureEngine;
+#endif
+
+#ifdef DETECT_PEDAL_COMBOS
+  PedalComboResolver& mPedalComboResolver;
+#endif
+
+  const Button* mButtons = NULL;
+  int mNumButtons = 0;
+
+  unsigned long mLastPedalChangeTimeMs = 0;
+
+  // The micros() time the wake ISR ran, and whether the wake latency is still to be measured.
+  static volatile unsigned long sWakeTimeUs;
+  static volatile bool sIsWakeLatencyPending;
+
+  unsigned long mMaxWakeLatencyUs = 0;
+};
+
+#endif
@@ -0,0 +1,54 @@
+/*******************************************************************************
+  KeyboardProfile.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef KeyboardProfile_H
+#define KeyboardProfile_H
+
+#include "../MidiAccompanimentController.h"
+
+// This file includes the keyboard profile selected in MidiAccompanimentController.h; only that profile is compiled into the firmware.
+// A profile provides the StyleNum and StyleSectionControlSwitchNum enums, the style select, section control and tempo SysEx templates
+// in flash, with the index of their variable bytes, and the keyboard's tempo range.
+//
+// There is one profile, the Yamaha arranger profile, from the PSR-SX900's style list. KEYBOARD_PSR_SX700 and KEYBOARD_GENOS are
+// aliases of KEYBOARD_PSR_SX900: the repo has no style list or tempo range for those keyboards, so they send the same messages.
+// Only the PSR-SX900's debug build names the selected styles, from its style catalog.
+// A style that the PSR-SX700 or Genos does not have must not be assigned to a pedal; the style select SysEx is not confirmed on a Genos.
+// A keyboard with its own data gets its own profile header, included here when it is selected.
+#if defined(KEYBOARD_PSR_SX700) || defined(KEYBOARD_PSR_SX900) || defined(KEYBOARD_GENOS)
+  #include "YamahaArrangerProfile.h"
+#endif
+
+static_assert(KeyboardStyleSelectMsbIndex + 1 < sizeof(KeyboardStyleSelectSysExTemplate) - 1, "The style select MSB and LSB must precede the end byte.");
+static_assert(KeyboardSectionSwitchNumIndex + 1 < sizeof(KeyboardSectionControlSysExTemplate) - 1, "The section switch number and on/off byte must precede the end byte.");
+static_assert(KeyboardTempoFirstByteIndex + 4 <= sizeof(KeyboardTempoSysExTemplate) - 1, "The four tempo bytes must precede the end byte.");
+static_assert(KeyboardMinTempo > 0 && KeyboardMinTempo <= KeyboardMaxTempo, "The keyboard's tempo range is not valid.");
+
+// The largest tempo of the pedal configuration, registration banks, set list and performance journal, whose tempos are 8 bits.
+// It is the keyboard's largest tempo, if that fits.
+const uint8_t MaxConfigTempo = KeyboardMaxTempo < 0xFF ? KeyboardMaxTempo : 0xFF;
+
+#endif
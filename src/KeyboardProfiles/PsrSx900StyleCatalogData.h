@@ -0,0 +1,659 @@
+// This file is generated by tools/generate_style_catalog.py from "sx900 style sysex.txt"; do not edit it.
+// It is included only by StyleCatalog.cpp.
+
+#ifndef PsrSx900StyleCatalogData_H
+#define PsrSx900StyleCatalogData_H
+
+#include <Arduino.h>
+
+#include "StyleCatalog.h"
+
+const uint16_t NumCatalogStyleEntries = 525;
+const uint8_t NumCatalogStyleCategories = 9;
+const uint16_t NumCatalogNameChars = 6037;
+
+// The category names, in catalog order.
+const char CatalogCategoryName0[] PROGMEM = "Pop&Rock";
+const char CatalogCategoryName1[] PROGMEM = "Dance";
+const char CatalogCategoryName2[] PROGMEM = "R&B";
+const char CatalogCategoryName3[] PROGMEM = "Jazz";
+const char CatalogCategoryName4[] PROGMEM = "Latin";
+const char CatalogCategoryName5[] PROGMEM = "Ballroom";
+const char CatalogCategoryName6[] PROGMEM = "Movie&Show";
+const char CatalogCategoryName7[] PROGMEM = "Entertainer";
+const char CatalogCategoryName8[] PROGMEM = "World";
+const char* const CatalogCategoryNames[NumCatalogStyleCategories] PROGMEM = {CatalogCategoryName0, CatalogCategoryName1, CatalogCategoryName2, CatalogCategoryName3, CatalogCategoryName4, CatalogCategoryName5, CatalogCategoryName6, CatalogCategoryName7, CatalogCategoryName8};
+
+// The entries, sorted by style number: {styleNum, nameOffset, categoryIndex}.
+const StyleCatalogEntry CatalogStyleEntries[NumCatalogStyleEntries] PROGMEM = {
+  {0x0000, 0, 7}, // PartyPolka
+  {0x0001, 10, 8}, // OberkrainerPolka1
+  {0x0200, 27, 0}, // Country2-4
+  {0x0201, 37, 8}, // Hoedown
+  {0x0207, 44, 0}, // TopChartCountry
+  {0x0209, 59, 8}, // Jing Ju Jie Zou
+  {0x020A, 74, 8}, // Bluegrass
+  {0x020E, 83, 7}, // OktoberRockHit
+  {0x0221, 97, 3}, // Ragtime
+  {0x0261, 104, 4}, // PopBossa
+  {0x0262, 112, 4}, // SlowBossa
+  {0x0264, 121, 4}, // BossaNova
+  {0x026B, 130, 4}, // LoungeBossa
+  {0x026C, 141, 4}, // BossaBrazil
+  {0x0272, 152, 4}, // BrazilianBossa
+  {0x0273, 166, 4}, // CoolBossa
+  {0x0275, 175, 4}, // SambaRio
+  {0x0300, 183, 7}, // RumbaIsland
+  {0x0340, 194, 6}, // US March
+  {0x0341, 202, 6}, // OrchestralMarch
+  {0x0343, 217, 8}, // GermanMarch1
+  {0x0344, 229, 8}, // GermanMarch2
+  {0x0347, 241, 8}, // Duranguense
+  {0x0348, 252, 8}, // US MarchingBand
+  {0x0360, 267, 7}, // PubPiano
+  {0x0361, 275, 7}, // PolkaPop
+  {0x0362, 283, 6}, // OrchestralPolka
+  {0x0363, 298, 8}, // OberkrainerPolka2
+  {0x0365, 315, 7}, // SchlagerPolka
+  {0x0367, 328, 8}, // ScottishReel
+  {0x0368, 340, 8}, // Sirtaki
+  {0x036A, 347, 8}, // MexicanDance
+  {0x036C, 359, 6}, // Sci-FiMarch
+  {0x0370, 370, 8}, // ScottishStrathspey
+  {0x0371, 388, 8}, // ZitherPolka
+  {0x0372, 399, 4}, // Forro
+  {0x0373, 404, 7}, // SingalongPiano
+  {0x0377, 418, 7}, // VolksDance
+  {0x0800, 428, 2}, // GospelSwing
+  {0x0A00, 439, 3}, // CountrySwing
+  {0x0A01, 451, 0}, // CountryShuffle
+  {0x0A03, 465, 0}, // CountrySingalong
+  {0x0A06, 481, 0}, // CountryFolkUpbeat
+  {0x0A20, 498, 5}, // Foxtrot
+  {0x0A21, 505, 5}, // SwingFox
+  {0x0A22, 513, 5}, // SlowFoxtrot2
+  {0x0A23, 525, 5}, // Quickstep2
+  {0x0A24, 535, 5}, // OrganQuickstep
+  {0x0A26, 549, 3}, // OrganSwing
+  {0x0A27, 559, 6}, // TapDanceSwing
+  {0x0A28, 572, 3}, // EasySwing
+  {0x0A29, 581, 3}, // FrenchJazz
+  {0x0A2A, 591, 5}, // Charleston
+  {0x0A2B, 601, 3}, // Dixieland
+  {0x0A2D, 610, 3}, // CoolJazzBallad
+  {0x0A37, 624, 8}, // Bhangra
+  {0x0A3B, 631, 3}, // PartyAGogo
+  {0x0A3C, 641, 5}, // Quickstep1
+  {0x0A3D, 651, 7}, // SingalongDanceBand
+  {0x0A40, 669, 3}, // EasyListening
+  {0x0A41, 682, 3}, // MidnightSwing
+  {0x0A43, 695, 3}, // BigBandFast2
+  {0x0A44, 707, 6}, // MovieSwing2
+  {0x0A46, 718, 3}, // OrchestralSwing1
+  {0x0A48, 734, 6}, // MovieSwing1
+  {0x0A49, 745, 3}, // BigBandBallad
+  {0x0A4A, 758, 3}, // DreamyBallad
+  {0x0A4C, 770, 3}, // 40sSwingBallad
+  {0x0A4D, 784, 5}, // VocalFoxtrot
+  {0x0A52, 796, 5}, // SlowFoxtrot1
+  {0x0A54, 808, 4}, // EuroPopMambo
+  {0x0B00, 820, 3}, // Tijuana
+  {0x0B20, 827, 4}, // HappyReggae
+  {0x0B40, 838, 6}, // 6-8March
+  {0x0B60, 846, 6}, // ChristmasSwing
+  {0x0B62, 860, 3}, // Hawaiian
+  {0x0B63, 868, 8}, // Tarantella
+  {0x0B65, 878, 8}, // ScottishPolka
+  {0x0B66, 891, 6}, // ChristmasBallad
+  {0x0C00, 906, 5}, // EnglishWaltz
+  {0x0C03, 918, 5}, // SlowWaltz
+  {0x0F62, 927, 6}, // ChristmasWaltz
+  {0x0F63, 941, 6}, // GuitarSerenade
+  {0x0F65, 955, 8}, // OberkrainerWaltz2
+  {0x0F67, 972, 8}, // FrenchMusette
+  {0x0F68, 985, 8}, // FrenchWaltz
+  {0x0F69, 996, 8}, // ItalianMazurka
+  {0x0F6A, 1010, 8}, // ItalianWaltz
+  {0x0F6B, 1022, 8}, // ScandWaltz
+  {0x0F6D, 1032, 8}, // Flamenco
+  {0x0F6E, 1040, 8}, // MariachiWaltz
+  {0x0F74, 1053, 8}, // ScottishWaltz
+  {0x0F76, 1066, 8}, // GermanWaltz
+  {0x0F78, 1077, 4}, // Joropo
+  {0x0F79, 1083, 3}, // RomanticWaltz
+  {0x0F7D, 1096, 8}, // OberkrainerWaltz1
+  {0x1000, 1113, 6}, // VienneseWaltz
+  {0x1001, 1126, 6}, // MovieSoundtrack
+  {0x1460, 1141, 2}, // GospelSisters
+  {0x1462, 1154, 8}, // CelticDance3-4
+  {0x1601, 1168, 8}, // CountryWaltz
+  {0x1621, 1180, 3}, // MediumJazzWaltz
+  {0x1622, 1195, 3}, // SlowJazzWaltz
+  {0x1623, 1208, 5}, // FinalWaltz
+  {0x1628, 1218, 5}, // VocalWaltz
+  {0x1629, 1228, 3}, // CoolJazzWaltz
+  {0x1800, 1241, 7}, // SchlagerPop
+  {0x1820, 1252, 6}, // MovieBallad
+  {0x1822, 1263, 6}, // EtherealMovie
+  {0x1826, 1276, 6}, // EtherealVoices
+  {0x1827, 1290, 6}, // OnBroadway
+  {0x1828, 1300, 8}, // BrassBand
+  {0x1829, 1309, 1}, // ChillPerformer
+  {0x182A, 1323, 1}, // CloudyBay
+  {0x182B, 1332, 1}, // NightWalk
+  {0x182C, 1341, 1}, // Play4Sofa
+  {0x182D, 1350, 1}, // AngelSun
+  {0x182F, 1358, 6}, // OrganHymn
+  {0x1830, 1367, 6}, // MovieHorns
+  {0x1B00, 1377, 5}, // Tango
+  {0x1B40, 1382, 6}, // It'sShowtime
+  {0x1B41, 1394, 6}, // AnimationFantasy
+  {0x1B60, 1410, 5}, // Pasodoble
+  {0x1B61, 1419, 8}, // SpanishPaso
+  {0x1C00, 1430, 5}, // Jive
+  {0x1C01, 1434, 2}, // 60sChartSwing
+  {0x1C60, 1447, 3}, // JumpJive
+  {0x1C61, 1455, 2}, // PianoBoogie
+  {0x1C64, 1466, 8}, // ScandBugg
+  {0x1C65, 1475, 2}, // BluesShuffle
+  {0x1C66, 1487, 2}, // DetroitPop
+  {0x1C67, 1497, 2}, // Rock&RollJive
+  {0x1C6E, 1510, 2}, // R&B Shuffle
+  {0x1C6F, 1521, 2}, // 50sRock&Roll
+  {0x1C74, 1533, 2}, // SoulShuffle
+  {0x1E20, 1544, 3}, // AcousticJazz
+  {0x1E26, 1556, 3}, // JazzGuitarClub
+  {0x1E2E, 1570, 3}, // ModernBigBand
+  {0x1E2F, 1583, 3}, // InstrumentalJazz
+  {0x1E30, 1599, 3}, // JazzOrganCombo
+  {0x1E31, 1613, 3}, // TradPianoJazz
+  {0x1E32, 1626, 3}, // TradPianoBallad
+  {0x1E34, 1641, 3}, // CoolPianoJazz
+  {0x1E35, 1654, 3}, // ManhattanSwing
+  {0x1E37, 1668, 3}, // CoolSwing
+  {0x1E3A, 1677, 3}, // FastJazz
+  {0x1E40, 1685, 3}, // BigBandMedium
+  {0x1E42, 1698, 3}, // OrchBigBand1
+  {0x1E43, 1710, 3}, // OrchBigBand2
+  {0x1E44, 1722, 3}, // ClassicBigBand
+  {0x1E45, 1736, 3}, // Swingin'BigBand
+  {0x1E46, 1751, 3}, // BigBandFast1
+  {0x1E49, 1763, 6}, // MoviePanther
+  {0x1E4A, 1775, 3}, // OrchestralSwing2
+  {0x1E4F, 1791, 3}, // BigBandShuffle
+  {0x1E51, 1805, 3}, // BigBandJazz
+  {0x1E52, 1816, 3}, // BigBandSwing
+  {0x1F61, 1828, 8}, // ScottishJig
+  {0x2400, 1839, 3}, // FiveFour
+  {0x2B60, 1847, 7}, // SchlagerWaltz
+  {0x2B61, 1860, 8}, // BohemianWaltz
+  {0x2B62, 1873, 2}, // AmazingGospel
+  {0x2B63, 1886, 0}, // 12-8PopBallad
+  {0x2C01, 1899, 2}, // VintageGuitarPop
+  {0x2C02, 1915, 1}, // Wonder8Beat
+  {0x2C03, 1926, 1}, // Cool8Beat
+  {0x2C05, 1935, 2}, // 60sShadowedPop
+  {0x2C06, 1949, 2}, // 60s8Beat
+  {0x2C07, 1957, 2}, // BubblegumPop
+  {0x2C08, 1969, 3}, // 8BeatAdria
+  {0x2C09, 1979, 8}, // FolkSongDuo
+  {0x2C0A, 1990, 0}, // UnpluggedPop
+  {0x2C0C, 2002, 3}, // JazzOrganGroove
+  {0x2C0D, 2017, 6}, // OrchPopClassics
+  {0x2C0E, 2032, 7}, // SchlagerBeat
+  {0x2C0F, 2044, 7}, // SchlagerAlp
+  {0x2C1B, 2055, 3}, // EuroPopOrgan
+  {0x2C1D, 2067, 1}, // Swedish8BeatPop
+  {0x2C20, 2082, 0}, // PianoBallad
+  {0x2C21, 2093, 0}, // LoveSong
+  {0x2C23, 2101, 3}, // 70sPopDuo1
+  {0x2C24, 2111, 1}, // 70s8BeatBallad
+  {0x2C25, 2125, 0}, // PowerBallad
+  {0x2C26, 2136, 3}, // EasyBallad
+  {0x2C28, 2146, 2}, // 60sOrganBallad
+  {0x2C2A, 2160, 3}, // EpicBallad
+  {0x2C2C, 2170, 6}, // SecretService
+  {0x2C2D, 2183, 6}, // BroadwayBallad
+  {0x2C2E, 2197, 2}, // WorshipSlow
+  {0x2C36, 2208, 0}, // IrishPopBallad
+  {0x2C39, 2222, 1}, // 80sPianoBallad
+  {0x2C3A, 2236, 0}, // 90s8BeatBallad
+  {0x2C3E, 2250, 3}, // 70sChartBallad
+  {0x2C3F, 2264, 0}, // 80sPowerRock
+  {0x2C40, 2276, 0}, // 70sHardRock
+  {0x2C43, 2287, 0}, // PowerRock
+  {0x2C44, 2296, 2}, // 60sVintageRock
+  {0x2C45, 2310, 2}, // 60sPopRock
+  {0x2C46, 2320, 0}, // Live8Beat
+  {0x2C47, 2329, 0}, // StandardRock
+  {0x2C51, 2341, 1}, // 80sGuitarPop
+  {0x2C52, 2353, 0}, // BritRockPop
+  {0x2C53, 2364, 0}, // 80sEdgyRock
+  {0x2C54, 2375, 0}, // 80sRockBeat
+  {0x2C55, 2386, 7}, // GermanRock
+  {0x2C56, 2396, 8}, // Xi Qing Luo Gu
+  {0x2C57, 2410, 7}, // SchlagerRock
+  {0x2C58, 2422, 0}, // StadiumRock
+  {0x2C59, 2433, 0}, // 70sStraightRock
+  {0x2C5A, 2448, 2}, // 60sUnderground
+  {0x2C5B, 2462, 7}, // DiscoFoxRock
+  {0x2C5C, 2474, 7}, // SchlagerFever
+  {0x2C5E, 2487, 0}, // 00sBoyBand
+  {0x2C60, 2497, 2}, // Twist
+  {0x2C62, 2502, 2}, // 60sRock&Roll
+  {0x2C64, 2514, 2}, // Rock&Roll
+  {0x2C65, 2523, 2}, // Skiffle
+  {0x2C67, 2530, 2}, // BeachRock
+  {0x2D00, 2539, 2}, // BluesRock
+  {0x2D01, 2548, 2}, // MotorCity
+  {0x2D02, 2557, 2}, // SoulSupreme
+  {0x2D07, 2568, 2}, // DetroitBeat
+  {0x2D20, 2579, 1}, // 70sDisco2
+  {0x2D24, 2588, 1}, // 90sDisco
+  {0x2D25, 2596, 6}, // MovieDisco
+  {0x2D2A, 2606, 1}, // FunkyHouse
+  {0x2D2B, 2616, 7}, // DiscoFox
+  {0x2D2C, 2624, 7}, // MallorcaParty
+  {0x2D2D, 2637, 7}, // PartyArena
+  {0x2D2E, 2647, 7}, // ApresSkiHit
+  {0x2D2F, 2658, 7}, // SynthPopDuo
+  {0x2D31, 2669, 7}, // YoungFox
+  {0x2D35, 2677, 6}, // 80sChristmas
+  {0x2D36, 2689, 1}, // 80sSynthDuo
+  {0x2D38, 2700, 7}, // ApresSkiParty
+  {0x2D39, 2713, 1}, // Slow'n'Swingin'
+  {0x2D3E, 2728, 2}, // JustRnB
+  {0x2D40, 2735, 1}, // ClubDance2
+  {0x2D42, 2745, 1}, // Ibiza2010
+  {0x2D43, 2754, 1}, // EuroTrance
+  {0x2D45, 2764, 1}, // RetroDance
+  {0x2D4B, 2774, 8}, // Bhajan
+  {0x2D4D, 2780, 1}, // MinimalElectro
+  {0x2D4E, 2794, 1}, // FrenchDJ
+  {0x2D52, 2802, 1}, // 80sTeenDisco
+  {0x2D54, 2814, 1}, // 80sRetroDisco
+  {0x2D55, 2827, 1}, // ElectroPop
+  {0x2D61, 2837, 8}, // Saeidy
+  {0x2D63, 2843, 8}, // WehdaSaghira
+  {0x2D64, 2855, 8}, // Laff
+  {0x2D65, 2859, 8}, // ArabicEuro
+  {0x2D66, 2869, 8}, // SaeidyPop
+  {0x2D67, 2878, 8}, // MalfufFunk
+  {0x2E00, 2888, 0}, // Country8Beat2
+  {0x2E01, 2901, 0}, // CountryRock
+  {0x2E02, 2912, 0}, // Country8Beat3
+  {0x2E03, 2925, 0}, // CountryPop
+  {0x2E04, 2935, 0}, // CountryHits
+  {0x2E05, 2946, 0}, // CountryBallad1
+  {0x2E06, 2960, 0}, // CountryBallad2
+  {0x2E07, 2974, 8}, // ScandCountry
+  {0x2E0D, 2986, 8}, // FolkPop
+  {0x2E0E, 2993, 0}, // CountryStrummin'
+  {0x2E0F, 3009, 3}, // 70sEasyPop
+  {0x2E10, 3019, 0}, // ModernPickin'
+  {0x2E11, 3032, 2}, // CountryBlues
+  {0x2E12, 3044, 0}, // CalifornianCountry
+  {0x2E13, 3062, 0}, // CountryStraits
+  {0x2E18, 3076, 0}, // CountryFolk8Beat
+  {0x2E19, 3092, 0}, // CountrySongwriter
+  {0x2E1A, 3109, 0}, // NashvillePop
+  {0x2E1D, 3121, 0}, // Country8Beat1
+  {0x2E1E, 3134, 3}, // HappyBeat
+  {0x2E20, 3143, 1}, // Up-tempo8Beat
+  {0x2E21, 3156, 2}, // Classic8Beat
+  {0x2E22, 3168, 3}, // EasyPop
+  {0x2E23, 3175, 2}, // 60sPianoPop
+  {0x2E24, 3186, 1}, // ModernHipHop
+  {0x2E25, 3198, 7}, // SchlagerFox
+  {0x2E26, 3209, 1}, // 80s8Beat
+  {0x2E2A, 3217, 7}, // SoftSchlager
+  {0x2E2B, 3229, 7}, // SchlagerPalace
+  {0x2E2C, 3243, 2}, // SurfRock
+  {0x2E2D, 3251, 0}, // BoyBandBallad
+  {0x2E2E, 3264, 8}, // AlpenLand
+  {0x2E30, 3273, 7}, // YoungBallad
+  {0x2E31, 3284, 3}, // Easy8Beat
+  {0x2E32, 3293, 0}, // CountryBeat
+  {0x2E39, 3304, 7}, // AlpenSchlager
+  {0x2E3B, 3317, 2}, // 60sBlueEyedSoul
+  {0x2E3C, 3332, 1}, // DanceFloor
+  {0x2E3D, 3342, 1}, // ChartEDM
+  {0x2E40, 3350, 1}, // 70sGlamPiano
+  {0x2E41, 3362, 6}, // AnimationBallad
+  {0x2E48, 3377, 0}, // OrchRockBallad1
+  {0x2E49, 3392, 6}, // MovieClassic
+  {0x2E4A, 3404, 0}, // PopEvergreen
+  {0x2E4B, 3416, 2}, // GospelBallad
+  {0x2E4C, 3428, 0}, // VocalPopBallad
+  {0x2E4D, 3442, 3}, // 70sPopDuo2
+  {0x2E4E, 3452, 0}, // Acoustic8BtBallad
+  {0x2E4F, 3469, 8}, // Keroncong
+  {0x2E51, 3478, 2}, // R&B SlowBallad
+  {0x2E52, 3492, 0}, // CanadianRock
+  {0x2E54, 3504, 0}, // ContempGtrPop
+  {0x2E5B, 3517, 0}, // SoulfulBallad
+  {0x2E5C, 3530, 0}, // SongwriterBallad
+  {0x2E5D, 3546, 1}, // 80sPopBallad
+  {0x2E5F, 3558, 0}, // UnpluggedBallad
+  {0x2F00, 3573, 5}, // Rumba
+  {0x2F01, 3578, 5}, // Beguine
+  {0x2F02, 3585, 4}, // BoleroLento
+  {0x2F03, 3596, 5}, // Cha-Cha
+  {0x2F04, 3603, 5}, // OrganCha-Cha
+  {0x2F0E, 3615, 3}, // OrganBossa
+  {0x2F0F, 3625, 4}, // Guajira
+  {0x2F11, 3632, 4}, // CubanCha-Cha
+  {0x2F12, 3644, 4}, // PopCha-Cha
+  {0x2F17, 3654, 7}, // PopRumba
+  {0x2F1C, 3662, 4}, // FastCha-Cha
+  {0x2F20, 3673, 4}, // GuitarRumba
+  {0x2F24, 3684, 7}, // SchlagerRumba
+  {0x2F25, 3697, 4}, // PopLatin
+  {0x2F28, 3705, 4}, // Bachata
+  {0x2F29, 3712, 5}, // OrganRumba
+  {0x2F2A, 3722, 4}, // PopLatinBallad
+  {0x2F2B, 3736, 2}, // 60sVintagePop
+  {0x2F2C, 3749, 4}, // SambaReggae
+  {0x2F2F, 3760, 4}, // RockCha-Cha
+  {0x2F30, 3771, 2}, // 60sVintageRumba
+  {0x2F33, 3786, 4}, // PopBachata
+  {0x2F66, 3796, 6}, // WildWest
+  {0x2F68, 3804, 6}, // BaroqueAir
+  {0x2F69, 3814, 7}, // 70sFrenchHit
+  {0x2F6B, 3826, 8}, // CelticDance
+  {0x2F70, 3837, 6}, // StringAdagio
+  {0x2F71, 3849, 8}, // ModCeltic4-4
+  {0x3221, 3861, 8}, // ModernDangdut1
+  {0x3222, 3875, 1}, // RetroSoul
+  {0x3223, 3884, 2}, // 60sSuperGroup
+  {0x3224, 3897, 7}, // ModernSchlager
+  {0x322C, 3911, 0}, // 16BeatRock
+  {0x322E, 3921, 1}, // 80sEuroPop
+  {0x322F, 3931, 0}, // 80sClassicRock
+  {0x3232, 3945, 7}, // VolksSchlager
+  {0x3238, 3958, 0}, // 80sRockDiva
+  {0x3400, 3969, 0}, // BritPopSwing
+  {0x3461, 3981, 2}, // Rock&RollShuffle
+  {0x3462, 3997, 1}, // SwedishPopShuffle
+  {0x3463, 4014, 2}, // OldiesRock&Roll
+  {0x3761, 4029, 8}, // ScandShuffle
+  {0x3820, 4041, 1}, // PopWaltz
+  {0x3C00, 4049, 7}, // SchlagerShuffle
+  {0x3C02, 4064, 2}, // LovelyShuffle
+  {0x3C03, 4077, 8}, // ScandSlowRock
+  {0x3C07, 4090, 0}, // 6-8ChartBallad
+  {0x3C20, 4104, 1}, // 80sDivaBallad
+  {0x3C21, 4117, 3}, // Orchestral6-8
+  {0x3C22, 4130, 6}, // Moonlight6-8
+  {0x3C23, 4142, 2}, // 6-8SlowRock
+  {0x3C24, 4153, 3}, // Orchestral12-8
+  {0x3C25, 4167, 7}, // Schlager6-8
+  {0x3C28, 4178, 2}, // 60sRisingPop
+  {0x3C2B, 4190, 8}, // ModCeltic6-8
+  {0x3C2C, 4202, 0}, // 6-8BalladRock
+  {0x3C2E, 4215, 0}, // 6-8GuitarBallad
+  {0x3C41, 4230, 0}, // 70sShuffleRock
+  {0x3C42, 4244, 0}, // 6-8Rock
+  {0x3C43, 4251, 0}, // RockShuffleFast
+  {0x3C44, 4266, 1}, // 80sClassic6-8
+  {0x3C60, 4279, 2}, // BlueberryBlues
+  {0x3D00, 4293, 2}, // 6-8SoulBallad
+  {0x3D02, 4306, 2}, // SlowBlues
+  {0x3D04, 4315, 2}, // SouthernGospel
+  {0x3D40, 4329, 1}, // 6-8ClassicSynth
+  {0x3F62, 4344, 7}, // AlpenBallad1
+  {0x3F63, 4356, 7}, // AlpenBallad2
+  {0x3F64, 4368, 2}, // Worship6-8
+  {0x3F65, 4378, 8}, // IrishHymn
+  {0x3F69, 4387, 6}, // GreenFantasia
+  {0x3F6A, 4400, 7}, // HelloShuffle
+  {0x4002, 4412, 0}, // 90sGuitarPop
+  {0x4004, 4424, 0}, // WestCoastPop
+  {0x4005, 4436, 6}, // 70sTV Theme
+  {0x4007, 4447, 1}, // Chillout1
+  {0x4008, 4456, 1}, // Chillout2
+  {0x4010, 4465, 6}, // 80sMovieBallad
+  {0x4012, 4479, 0}, // CrazyPop
+  {0x4014, 4487, 1}, // TurkishEuro
+  {0x4016, 4498, 2}, // CoolR&B
+  {0x4019, 4505, 2}, // 60sBigHit
+  {0x401E, 4514, 1}, // 80sBritishPop
+  {0x401F, 4527, 0}, // BoyBandPop
+  {0x4021, 4537, 0}, // 16BeatBallad
+  {0x4023, 4549, 0}, // SmoothPopBallad
+  {0x402C, 4564, 1}, // 80sBoyBand
+  {0x402F, 4574, 0}, // ModernPopBallad
+  {0x4030, 4589, 2}, // SoulBallad
+  {0x4031, 4599, 1}, // SynthPop
+  {0x4032, 4607, 1}, // ChilloutCafe
+  {0x4033, 4619, 2}, // 90sSmoothBallad
+  {0x4034, 4634, 2}, // 80sSmoothBallad
+  {0x4035, 4649, 4}, // LatinPartyPop
+  {0x4037, 4662, 1}, // 80sAnalogBallad
+  {0x4042, 4677, 2}, // LiveSoulBand
+  {0x4043, 4689, 0}, // FunkPopRock
+  {0x4044, 4700, 0}, // AcousticRock
+  {0x4045, 4712, 0}, // OrchRockBallad2
+  {0x4049, 4727, 0}, // 90sRockBallad
+  {0x404B, 4740, 0}, // NashvilleRock
+  {0x404E, 4753, 0}, // ElectroRock
+  {0x404F, 4764, 6}, // BlockbusterBallad
+  {0x4050, 4781, 0}, // US CountryPop
+  {0x4100, 4794, 2}, // Mr.Soul
+  {0x4101, 4801, 2}, // GospelBrothers
+  {0x4104, 4815, 2}, // JazzFunk
+  {0x4105, 4823, 2}, // FranklySoul
+  {0x4107, 4834, 2}, // 70sChartSoul
+  {0x4109, 4846, 2}, // R&B SoulBallad
+  {0x410A, 4860, 1}, // FunkDisco
+  {0x4120, 4869, 1}, // PhillyDisco
+  {0x4122, 4880, 1}, // 70sDisco1
+  {0x4123, 4889, 1}, // 70sDiscoFunk
+  {0x4124, 4901, 6}, // SaturdayNight
+  {0x412B, 4914, 4}, // Axe
+  {0x412D, 4917, 1}, // 80sSynthPop
+  {0x412F, 4928, 1}, // 80sFunkIcon
+  {0x4131, 4939, 0}, // CanadianTeenPop
+  {0x4132, 4954, 1}, // 70sSpanishDisco
+  {0x4144, 4969, 1}, // DreamDance
+  {0x4147, 4979, 1}, // GlobalDJs
+  {0x4151, 4988, 1}, // TrancePop
+  {0x4155, 4997, 1}, // Electronica
+  {0x4156, 5008, 1}, // ClubDance1
+  {0x4159, 5018, 7}, // MallorcaDisco
+  {0x415A, 5031, 1}, // DirtyPop
+  {0x415B, 5039, 1}, // FrenchClub
+  {0x415F, 5049, 1}, // ReggaetonDJ
+  {0x4160, 5060, 1}, // HipHop
+  {0x4166, 5066, 1}, // NatureHipHop
+  {0x416A, 5078, 0}, // UK FolkPop
+  {0x4204, 5088, 0}, // CountryBallad3
+  {0x4220, 5102, 1}, // ClubMixDJ
+  {0x4221, 5111, 1}, // BigRoom
+  {0x4222, 5118, 1}, // US ClubDance
+  {0x4226, 5130, 1}, // ClubHouse
+  {0x4227, 5139, 1}, // MiamiHouse
+  {0x4228, 5149, 1}, // ElectroHouse
+  {0x4229, 5161, 1}, // GangstaHouse
+  {0x422A, 5173, 1}, // GrindHouse
+  {0x422B, 5183, 1}, // PianoHouse
+  {0x422C, 5193, 1}, // ElectroStep
+  {0x422D, 5204, 1}, // Eurodance1
+  {0x422E, 5214, 1}, // Eurodance2
+  {0x422F, 5224, 1}, // TropicalHouse
+  {0x4232, 5237, 0}, // SkyPop
+  {0x4233, 5243, 7}, // DreamSchlager
+  {0x4236, 5256, 1}, // Dubstep
+  {0x4237, 5263, 7}, // FantasyFox
+  {0x4238, 5273, 1}, // PartyAnthem
+  {0x4239, 5284, 1}, // ElectroHouse
+  {0x423A, 5296, 1}, // DangerDance
+  {0x423C, 5307, 1}, // EDM Anthem
+  {0x4261, 5317, 5}, // OrganSamba
+  {0x4263, 5327, 5}, // Samba
+  {0x4268, 5332, 4}, // JazzSamba
+  {0x430E, 5341, 4}, // Salsa
+  {0x430F, 5346, 4}, // Guaguanco
+  {0x4310, 5355, 4}, // CubanSon
+  {0x4311, 5363, 4}, // Parranda
+  {0x4312, 5371, 8}, // Grupera
+  {0x4313, 5378, 4}, // SalsaGranCiclon
+  {0x431D, 5393, 4}, // LiveMerengue
+  {0x4325, 5405, 4}, // RumbaFlamenco
+  {0x4328, 5418, 4}, // TangoFlamencos
+  {0x4360, 5432, 7}, // SchlagerSamba
+  {0x4362, 5445, 8}, // IrishDance
+  {0x4366, 5455, 8}, // ModernDangdut2
+  {0x4368, 5469, 1}, // DiscoSurvival
+  {0x4502, 5482, 0}, // 80sSynthRock
+  {0x4520, 5494, 1}, // DiscoChocolate
+  {0x4540, 5508, 1}, // 80sDiscoBeat
+  {0x4545, 5520, 1}, // 80sMonsterHit
+  {0x4563, 5533, 2}, // 70sCoolBallad
+  {0x4720, 5546, 4}, // SheriffReggae
+  {0x4802, 5559, 2}, // FusionShuffle
+  {0x4803, 5572, 2}, // JazzFusion
+  {0x4805, 5582, 2}, // KoolShuffle
+  {0x4808, 5593, 0}, // ChartPianoShuffle
+  {0x4809, 5610, 0}, // PopRockShuffle
+  {0x480A, 5624, 2}, // HollywoodGospel
+  {0x480B, 5639, 2}, // 70sScatLegend
+  {0x480E, 5652, 2}, // FunkyShuffle
+  {0x4942, 5664, 1}, // ClubHouse
+  {0x4945, 5673, 0}, // 90sAussiePop
+  {0x4946, 5685, 6}, // PopMusical
+  {0x4968, 5695, 0}, // 90sPopShuffle
+  {0x4969, 5708, 2}, // FunkPop
+  {0x496C, 5715, 1}, // StreetBeatbox
+  {0x4C20, 5728, 0}, // US FolkPop
+  {0x4E60, 5738, 0}, // CountryFolkBallad
+  {0x4E65, 5755, 6}, // Gunslinger
+  {0x4E68, 5765, 6}, // IcyBallad
+  {0x4E69, 5774, 0}, // US SingerPop
+  {0x4E6A, 5786, 6}, // OrchMovieBallad
+  {0x4E6B, 5801, 0}, // IrishPopRock
+  {0x4F20, 5813, 2}, // UK Soul
+  {0x4F21, 5820, 0}, // GrungeRock
+  {0x5021, 5830, 0}, // CountryPopDuo
+  {0x5142, 5843, 1}, // ClubReggaeton
+  {0x5144, 5856, 4}, // PopCumbia
+  {0x5149, 5865, 0}, // DancehallPop
+  {0x514A, 5877, 0}, // UK SoftRock
+  {0x514B, 5888, 0}, // ReggaetonSlowJam
+  {0x514C, 5904, 4}, // 80sBrazilianPop
+  {0x514D, 5919, 0}, // ReggaetonPop
+  {0x514E, 5931, 4}, // Reggaeton2
+  {0x5201, 5941, 0}, // KissDancePop
+  {0x5205, 5953, 0}, // 90sUS ChartBallad
+  {0x5206, 5970, 1}, // 90sPopBallad
+  {0x5249, 5982, 0}, // US ElectroPop
+  {0x524A, 5995, 1}, // ClassicalPop
+  {0x524B, 6007, 0}, // 90sDancePop
+  {0x5344, 6018, 4}, // Reggaeton1
+  {0x7B01, 6028, 3} // AfroCuban
+};
+
+// The entry index of each style, in catalog order.
+const uint16_t CatalogOrderEntryIndexes[NumCatalogStyleEntries] PROGMEM = {
+  455, 517, 511, 392, 515, 303, 512, 341, 207, 507, 306, 308, 365, 162, 305, 268,
+  42, 269, 270, 409, 520, 499, 503, 427, 494, 194, 366, 208, 343, 193, 189, 394,
+  393, 178, 191, 412, 508, 266, 256, 257, 440, 346, 381, 387, 513, 202, 345, 408,
+  294, 407, 171, 179, 355, 283, 396, 518, 500, 258, 259, 441, 198, 296, 212, 505,
+  382, 367, 368, 203, 479, 195, 182, 298, 300, 489, 496, 271, 253, 255, 287, 40,
+  522, 405, 488, 304, 254, 410, 201, 199, 406, 364, 264, 262, 267, 4, 2, 41,
+  459, 509, 457, 290, 461, 482, 244, 342, 425, 369, 246, 462, 235, 291, 460, 521,
+  338, 519, 165, 164, 442, 243, 437, 242, 439, 245, 391, 233, 426, 307, 498, 443,
+  444, 433, 237, 273, 177, 348, 398, 395, 239, 240, 493, 429, 430, 421, 222, 478,
+  428, 422, 431, 432, 277, 225, 435, 356, 200, 279, 190, 403, 445, 446, 447, 448,
+  449, 450, 451, 452, 453, 454, 436, 238, 399, 384, 385, 292, 181, 480, 420, 419,
+  112, 113, 114, 115, 116, 481, 374, 351, 223, 438, 388, 413, 134, 220, 130, 219,
+  289, 166, 329, 184, 125, 353, 416, 371, 506, 221, 362, 209, 276, 167, 326, 372,
+  218, 129, 265, 492, 215, 133, 214, 131, 347, 236, 132, 487, 485, 483, 349, 213,
+  216, 127, 370, 401, 400, 418, 389, 302, 339, 390, 196, 197, 163, 161, 490, 38,
+  297, 373, 282, 217, 274, 359, 168, 377, 188, 414, 98, 397, 415, 486, 491, 417,
+  404, 497, 156, 155, 149, 137, 65, 63, 153, 357, 56, 272, 135, 142, 138, 144,
+  54, 66, 183, 185, 360, 71, 172, 139, 136, 147, 148, 180, 299, 263, 192, 50,
+  140, 141, 143, 145, 105, 275, 59, 60, 67, 176, 102, 101, 51, 524, 158, 48,
+  314, 94, 169, 286, 151, 61, 146, 150, 154, 39, 75, 53, 8, 126, 523, 516,
+  317, 328, 319, 15, 13, 12, 10, 11, 316, 323, 330, 510, 424, 16, 327, 471,
+  473, 474, 402, 514, 70, 472, 14, 469, 35, 93, 468, 315, 467, 466, 311, 320,
+  465, 322, 9, 325, 484, 72, 103, 104, 79, 80, 124, 57, 46, 69, 45, 68,
+  312, 464, 309, 310, 119, 122, 43, 44, 52, 47, 313, 463, 324, 501, 331, 186,
+  32, 97, 110, 118, 108, 109, 295, 121, 293, 502, 152, 411, 96, 173, 335, 358,
+  26, 224, 423, 383, 386, 107, 73, 18, 19, 332, 379, 232, 78, 74, 81, 117,
+  64, 62, 495, 120, 49, 504, 187, 82, 456, 458, 234, 318, 206, 288, 37, 7,
+  344, 278, 231, 285, 380, 340, 106, 174, 175, 321, 361, 211, 375, 376, 0, 28,
+  281, 25, 352, 475, 226, 210, 204, 159, 227, 434, 228, 280, 229, 230, 17, 333,
+  58, 36, 24, 3, 6, 100, 336, 363, 1, 27, 34, 95, 83, 251, 247, 248,
+  249, 250, 337, 477, 301, 55, 241, 157, 29, 33, 77, 91, 111, 378, 99, 334,
+  476, 5, 205, 22, 470, 252, 354, 260, 128, 350, 88, 84, 85, 76, 30, 31,
+  160, 92, 87, 86, 90, 89, 123, 23, 20, 21, 284, 170, 261
+};
+
+// The style names, packed without terminators, in entry order.
+const char CatalogNameChars[NumCatalogNameChars + 1] PROGMEM =
+  "PartyPolkaOberkrainerPolka1Country2-4HoedownTopChartCountryJing Ju Jie ZouBluegrassOktoberRockHi"
+  "tRagtimePopBossaSlowBossaBossaNovaLoungeBossaBossaBrazilBrazilianBossaCoolBossaSambaRioRumbaIsla"
+  "ndUS MarchOrchestralMarchGermanMarch1GermanMarch2DuranguenseUS MarchingBandPubPianoPolkaPopOrche"
+  "stralPolkaOberkrainerPolka2SchlagerPolkaScottishReelSirtakiMexicanDanceSci-FiMarchScottishStrath"
+  "speyZitherPolkaForroSingalongPianoVolksDanceGospelSwingCountrySwingCountryShuffleCountrySingalon"
+  "gCountryFolkUpbeatFoxtrotSwingFoxSlowFoxtrot2Quickstep2OrganQuickstepOrganSwingTapDanceSwingEasy"
+  "SwingFrenchJazzCharlestonDixielandCoolJazzBalladBhangraPartyAGogoQuickstep1SingalongDanceBandEas"
+  "yListeningMidnightSwingBigBandFast2MovieSwing2OrchestralSwing1MovieSwing1BigBandBalladDreamyBall"
+  "ad40sSwingBalladVocalFoxtrotSlowFoxtrot1EuroPopMamboTijuanaHappyReggae6-8MarchChristmasSwingHawa"
+  "iianTarantellaScottishPolkaChristmasBalladEnglishWaltzSlowWaltzChristmasWaltzGuitarSerenadeOberk"
+  "rainerWaltz2FrenchMusetteFrenchWaltzItalianMazurkaItalianWaltzScandWaltzFlamencoMariachiWaltzSco"
+  "ttishWaltzGermanWaltzJoropoRomanticWaltzOberkrainerWaltz1VienneseWaltzMovieSoundtrackGospelSiste"
+  "rsCelticDance3-4CountryWaltzMediumJazzWaltzSlowJazzWaltzFinalWaltzVocalWaltzCoolJazzWaltzSchlage"
+  "rPopMovieBalladEtherealMovieEtherealVoicesOnBroadwayBrassBandChillPerformerCloudyBayNightWalkPla"
+  "y4SofaAngelSunOrganHymnMovieHornsTangoIt'sShowtimeAnimationFantasyPasodobleSpanishPasoJive60sCha"
+  "rtSwingJumpJivePianoBoogieScandBuggBluesShuffleDetroitPopRock&RollJiveR&B Shuffle50sRock&RollSou"
+  "lShuffleAcousticJazzJazzGuitarClubModernBigBandInstrumentalJazzJazzOrganComboTradPianoJazzTradPi"
+  "anoBalladCoolPianoJazzManhattanSwingCoolSwingFastJazzBigBandMediumOrchBigBand1OrchBigBand2Classi"
+  "cBigBandSwingin'BigBandBigBandFast1MoviePantherOrchestralSwing2BigBandShuffleBigBandJazzBigBandS"
+  "wingScottishJigFiveFourSchlagerWaltzBohemianWaltzAmazingGospel12-8PopBalladVintageGuitarPopWonde"
+  "r8BeatCool8Beat60sShadowedPop60s8BeatBubblegumPop8BeatAdriaFolkSongDuoUnpluggedPopJazzOrganGroov"
+  "eOrchPopClassicsSchlagerBeatSchlagerAlpEuroPopOrganSwedish8BeatPopPianoBalladLoveSong70sPopDuo17"
+  "0s8BeatBalladPowerBalladEasyBallad60sOrganBalladEpicBalladSecretServiceBroadwayBalladWorshipSlow"
+  "IrishPopBallad80sPianoBallad90s8BeatBallad70sChartBallad80sPowerRock70sHardRockPowerRock60sVinta"
+  "geRock60sPopRockLive8BeatStandardRock80sGuitarPopBritRockPop80sEdgyRock80sRockBeatGermanRockXi Q"
+  "ing Luo GuSchlagerRockStadiumRock70sStraightRock60sUndergroundDiscoFoxRockSchlagerFever00sBoyBan"
+  "dTwist60sRock&RollRock&RollSkiffleBeachRockBluesRockMotorCitySoulSupremeDetroitBeat70sDisco290sD"
+  "iscoMovieDiscoFunkyHouseDiscoFoxMallorcaPartyPartyArenaApresSkiHitSynthPopDuoYoungFox80sChristma"
+  "s80sSynthDuoApresSkiPartySlow'n'Swingin'JustRnBClubDance2Ibiza2010EuroTranceRetroDanceBhajanMini"
+  "malElectroFrenchDJ80sTeenDisco80sRetroDiscoElectroPopSaeidyWehdaSaghiraLaffArabicEuroSaeidyPopMa"
+  "lfufFunkCountry8Beat2CountryRockCountry8Beat3CountryPopCountryHitsCountryBallad1CountryBallad2Sc"
+  "andCountryFolkPopCountryStrummin'70sEasyPopModernPickin'CountryBluesCalifornianCountryCountryStr"
+  "aitsCountryFolk8BeatCountrySongwriterNashvillePopCountry8Beat1HappyBeatUp-tempo8BeatClassic8Beat"
+  "EasyPop60sPianoPopModernHipHopSchlagerFox80s8BeatSoftSchlagerSchlagerPalaceSurfRockBoyBandBallad"
+  "AlpenLandYoungBalladEasy8BeatCountryBeatAlpenSchlager60sBlueEyedSoulDanceFloorChartEDM70sGlamPia"
+  "noAnimationBalladOrchRockBallad1MovieClassicPopEvergreenGospelBalladVocalPopBallad70sPopDuo2Acou"
+  "stic8BtBalladKeroncongR&B SlowBalladCanadianRockContempGtrPopSoulfulBalladSongwriterBallad80sPop"
+  "BalladUnpluggedBalladRumbaBeguineBoleroLentoCha-ChaOrganCha-ChaOrganBossaGuajiraCubanCha-ChaPopC"
+  "ha-ChaPopRumbaFastCha-ChaGuitarRumbaSchlagerRumbaPopLatinBachataOrganRumbaPopLatinBallad60sVinta"
+  "gePopSambaReggaeRockCha-Cha60sVintageRumbaPopBachataWildWestBaroqueAir70sFrenchHitCelticDanceStr"
+  "ingAdagioModCeltic4-4ModernDangdut1RetroSoul60sSuperGroupModernSchlager16BeatRock80sEuroPop80sCl"
+  "assicRockVolksSchlager80sRockDivaBritPopSwingRock&RollShuffleSwedishPopShuffleOldiesRock&RollSca"
+  "ndShufflePopWaltzSchlagerShuffleLovelyShuffleScandSlowRock6-8ChartBallad80sDivaBalladOrchestral6"
+  "-8Moonlight6-86-8SlowRockOrchestral12-8Schlager6-860sRisingPopModCeltic6-86-8BalladRock6-8Guitar"
+  "Ballad70sShuffleRock6-8RockRockShuffleFast80sClassic6-8BlueberryBlues6-8SoulBalladSlowBluesSouth"
+  "ernGospel6-8ClassicSynthAlpenBallad1AlpenBallad2Worship6-8IrishHymnGreenFantasiaHelloShuffle90sG"
+  "uitarPopWestCoastPop70sTV ThemeChillout1Chillout280sMovieBalladCrazyPopTurkishEuroCoolR&B60sBigH"
+  "it80sBritishPopBoyBandPop16BeatBalladSmoothPopBallad80sBoyBandModernPopBalladSoulBalladSynthPopC"
+  "hilloutCafe90sSmoothBallad80sSmoothBalladLatinPartyPop80sAnalogBalladLiveSoulBandFunkPopRockAcou"
+  "sticRockOrchRockBallad290sRockBalladNashvilleRockElectroRockBlockbusterBalladUS CountryPopMr.Sou"
+  "lGospelBrothersJazzFunkFranklySoul70sChartSoulR&B SoulBalladFunkDiscoPhillyDisco70sDisco170sDisc"
+  "oFunkSaturdayNightAxe80sSynthPop80sFunkIconCanadianTeenPop70sSpanishDiscoDreamDanceGlobalDJsTran"
+  "cePopElectronicaClubDance1MallorcaDiscoDirtyPopFrenchClubReggaetonDJHipHopNatureHipHopUK FolkPop"
+  "CountryBallad3ClubMixDJBigRoomUS ClubDanceClubHouseMiamiHouseElectroHouseGangstaHouseGrindHouseP"
+  "ianoHouseElectroStepEurodance1Eurodance2TropicalHouseSkyPopDreamSchlagerDubstepFantasyFoxPartyAn"
+  "themElectroHouseDangerDanceEDM AnthemOrganSambaSambaJazzSambaSalsaGuaguancoCubanSonParrandaGrupe"
+  "raSalsaGranCiclonLiveMerengueRumbaFlamencoTangoFlamencosSchlagerSambaIrishDanceModernDangdut2Dis"
+  "coSurvival80sSynthRockDiscoChocolate80sDiscoBeat80sMonsterHit70sCoolBalladSheriffReggaeFusionShu"
+  "ffleJazzFusionKoolShuffleChartPianoShufflePopRockShuffleHollywoodGospel70sScatLegendFunkyShuffle"
+  "ClubHouse90sAussiePopPopMusical90sPopShuffleFunkPopStreetBeatboxUS FolkPopCountryFolkBalladGunsl"
+  "ingerIcyBalladUS SingerPopOrchMovieBalladIrishPopRockUK SoulGrungeRockCountryPopDuoClubReggaeton"
+  "PopCumbiaDancehallPopUK SoftRockReggaetonSlowJam80sBrazilianPopReggaetonPopReggaeton2KissDancePo"
+  "p90sUS ChartBallad90sPopBalladUS ElectroPopClassicalPop90sDancePopReggaeton1AfroCuban";
+
+#endif
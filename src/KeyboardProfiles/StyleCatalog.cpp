@@ -0,0 +1,100 @@
+/*******************************************************************************
+  StyleCatalog.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include <Arduino.h>
+
+#include "StyleCatalog.h"
+#include "PsrSx900StyleCatalogData.h"
+
+// The functions are not used when sending MIDI, and the linker then leaves the catalog out of flash.
+
+uint16_t GetNumCatalogStyles()
+{
+  return NumCatalogStyleEntries;
+}
+
+uint16_t FindCatalogStyle(uint16_t styleNum)
+{
+  uint16_t low = 0;
+  uint16_t high = NumCatalogStyleEntries;
+  while (low < high)
+  {
+    uint16_t middle = (low + high) / 2;
+    uint16_t middleStyleNum = GetCatalogStyleNum(middle);
+    if (middleStyleNum == styleNum)
+    {
+      return middle;
+    }
+
+    if (middleStyleNum < styleNum)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  return NoCatalogEntryIndex;
+}
+
+uint16_t GetCatalogOrderEntryIndex(uint16_t catalogOrder)
+{
+  if (catalogOrder == 0 || catalogOrder > NumCatalogStyleEntries)
+  {
+    return NoCatalogEntryIndex;
+  }
+
+  return pgm_read_word(&CatalogOrderEntryIndexes[catalogOrder - 1]);
+}
+
+uint16_t GetCatalogStyleNum(uint16_t entryIndex)
+{
+  return pgm_read_word(&CatalogStyleEntries[entryIndex].styleNum);
+}
+
+uint8_t GetCatalogStyleCategoryIndex(uint16_t entryIndex)
+{
+  return pgm_read_byte(&CatalogStyleEntries[entryIndex].categoryIndex);
+}
+
+uint8_t ReadCatalogStyleName(uint16_t entryIndex, char* name, uint8_t maxNameChars)
+{
+  uint16_t nameOffset = pgm_read_word(&CatalogStyleEntries[entryIndex].nameOffset);
+  uint16_t nameEndOffset = entryIndex + 1 < NumCatalogStyleEntries ? pgm_read_word(&CatalogStyleEntries[entryIndex + 1].nameOffset) : NumCatalogNameChars;
+
+  uint8_t numNameChars = min(nameEndOffset - nameOffset, (uint16_t)maxNameChars);
+  memcpy_P(name, &CatalogNameChars[nameOffset], numNameChars);
+  name[numNameChars] = '\0';
+
+  return numNameChars;
+}
+
+const __FlashStringHelper* GetCatalogCategoryName(uint8_t categoryIndex)
+{
+  return (const __FlashStringHelper*)pgm_read_ptr(&CatalogCategoryNames[categoryIndex]);
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+  StyleCatalog.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef StyleCatalog_H
+#define StyleCatalog_H
+
+#include <Arduino.h>
+
+// This struct is a style catalog entry, stored in flash; 5 bytes per style.
+struct StyleCatalogEntry
+{
+  uint16_t styleNum;
+
+  // The offset of the style's name in the packed names; the name ends where the next entry's name starts.
+  uint16_t nameOffset;
+
+  uint8_t categoryIndex;
+};
+
+// The style catalog lists the keyboard's styles, with their names and categories, entirely in flash; it uses no RAM.
+// It is generated from "sx900 style sysex.txt" by tools/generate_style_catalog.py. The entries are sorted by style number,
+// so a style is found by binary search; the catalog order, the order of the keyboard's style list, maps to an entry in one read.
+// An entry is given by its index, from 0 to GetNumCatalogStyles() - 1.
+
+const uint16_t NoCatalogEntryIndex = 0xFFFF;
+
+// This function returns the number of styles in the catalog.
+uint16_t GetNumCatalogStyles();
+
+// This function returns the entry index of the style number, or NoCatalogEntryIndex if the style is not in the catalog.
+uint16_t FindCatalogStyle(uint16_t styleNum);
+
+// This function returns the entry index of the style at the catalog order, from 1 to GetNumCatalogStyles().
+uint16_t GetCatalogOrderEntryIndex(uint16_t catalogOrder);
+
+uint16_t GetCatalogStyleNum(uint16_t entryIndex);
+uint8_t GetCatalogStyleCategoryIndex(uint16_t entryIndex);
+
+// This function copies the style's name into name, terminated, truncated to maxNameChars characters. It returns the name's length.
+uint8_t ReadCatalogStyleName(uint16_t entryIndex, char* name, uint8_t maxNameChars);
+
+// This function returns the category's name, in flash.
+const __FlashStringHelper* GetCatalogCategoryName(uint8_t categoryIndex);
+
+#endif
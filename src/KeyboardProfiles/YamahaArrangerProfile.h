@@ -0,0 +1,58 @@
+/*******************************************************************************
+  YamahaArrangerProfile.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef YamahaArrangerProfile_H
+#define YamahaArrangerProfile_H
+
+#include <Arduino.h>
+
+#include "YamahaStyleSections.h"
+#include "PsrSx900Styles.h"
+
+// The Yamaha arranger keyboard profile; the PSR-SX700, PSR-SX900 and Genos selections all use it. Do not include this file;
+// include KeyboardProfile.h, which includes the selected profile. The SysEx formats and style numbers are from
+// Yamaha Tech Support's PSR-SX900 style list, "sx900 style sysex.txt".
+
+// The style select SysEx; dd dd is the MSB and LSB of the StyleNum.
+// F0 43 73 01 51 05 00 03 04 00 00 dd dd F7
+constexpr uint8_t KeyboardStyleSelectSysExTemplate[] PROGMEM = {0xF0, 0x43, 0x73, 0x01, 0x51, 0x05, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF7};
+const uint8_t KeyboardStyleSelectMsbIndex = 11;
+
+// The Style Section Control SysEx; ss = StyleSectionControlSwitchNum, dd = 7F (on) or 00 (off).
+// F0 43 7E 00 ss dd F7
+constexpr uint8_t KeyboardSectionControlSysExTemplate[] PROGMEM = {0xF0, 0x43, 0x7E, 0x00, 0x00, 0x00, 0xF7};
+const uint8_t KeyboardSectionSwitchNumIndex = 4;
+
+// The tempo SysEx; t4 t3 t2 t1 = the microseconds per quarter note, 7 bits per byte, most significant first.
+// F0 43 7E 01 t4 t3 t2 t1 F7
+constexpr uint8_t KeyboardTempoSysExTemplate[] PROGMEM = {0xF0, 0x43, 0x7E, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF7};
+const uint8_t KeyboardTempoFirstByteIndex = 4;
+
+// The tempo range the keyboard accepts, in BPM.
+const uint16_t KeyboardMinTempo = 5;
+const uint16_t KeyboardMaxTempo = 500;
+
+#endif
@@ -33,12 +33,53 @@ MIDIEventFlasher::MIDIEventFlasher()
 
 void MIDIEventFlasher::OnMidiEvent()
 {
+  if (mNumCountStepsLeft != 0)
+  {
+    // Keep the counted flashes legible.
+    return;
+  }
+
   mFlashOnStartTimestampMilliseconds = millis();
   digitalWrite(LedPin, HIGH);
 }
 
+void MIDIEventFlasher::FlashCount(uint8_t numFlashes)
+{
+  if (numFlashes == 0)
+  {
+    return;
+  }
+
+  // The first step, LED on, starts now; each flash is then an off and an on toggle, and the last toggle turns the LED off.
+  mFlashOnStartTimestampMilliseconds = 0;
+  mNumCountStepsLeft = numFlashes * 2 - 1;
+  mCountStepStartTimestampMilliseconds = millis();
+  digitalWrite(LedPin, HIGH);
+}
+
+void MIDIEventFlasher::UpdateCountFlashes()
+{
+  uint32_t curTimestampMilliseconds = millis();
+
+  // Unsigned subtraction is correct across the millis() rollover.
+  if (curTimestampMilliseconds - mCountStepStartTimestampMilliseconds < IndicatorFlashStepMilliseconds)
+  {
+    return;
+  }
+
+  mNumCountStepsLeft--;
+  mCountStepStartTimestampMilliseconds = curTimestampMilliseconds;
+  digitalWrite(LedPin, (mNumCountStepsLeft & 1) != 0 ? HIGH : LOW);
+}
+
 void MIDIEventFlasher::UpdateStatusLed()
 {
+  if (mNumCountStepsLeft != 0)
+  {
+    UpdateCountFlashes();
+    return;
+  }
+
   if (mFlashOnStartTimestampMilliseconds == 0)
   {
     // LED already off.
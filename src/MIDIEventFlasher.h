@@ -44,10 +44,28 @@ public:
   // This method must be called periodically in order to turn off the LED after the last request to flash the LED.
   void UpdateStatusLed();
 
+  // This method starts flashing the LED numFlashes times, IndicatorFlashStepMilliseconds on and off, without blocking.
+  // MIDI event flashes are not shown until the flashes end.
+  void FlashCount(uint8_t numFlashes);
+
+  // This method returns true while the LED is flashing.
+  bool IsFlashing() const { return mFlashOnStartTimestampMilliseconds != 0 || mNumCountStepsLeft != 0; }
+
+  // This method returns true while counted flashes are shown.
+  bool IsFlashingCount() const { return mNumCountStepsLeft != 0; }
+
+private:
+  // This method advances the counted flashes, when the current on or off step ends.
+  void UpdateCountFlashes();
+
 private:
 
   // This member is the timestamp at which the LED was turned on. If LED is off, its value is 0.
   uint32_t mFlashOnStartTimestampMilliseconds = 0;
+
+  // The number of LED toggles left in the counted flashes, and the timestamp of the last one. The LED is on while the number is odd.
+  uint8_t mNumCountStepsLeft = 0;
+  uint32_t mCountStepStartTimestampMilliseconds = 0;
 };
 
 #endif
@@ -31,4 +31,147 @@
 // Comment out SEND_MIDI to debug MIDI using the Serial Monitor.
 #define SEND_MIDI
 
+// The following compiler directives select the keyboard profile; exactly one must be defined. See KeyboardProfiles/KeyboardProfile.h.
+// KEYBOARD_PSR_SX700 and KEYBOARD_GENOS are aliases of KEYBOARD_PSR_SX900, whose SysEx formats and style numbers they use.
+// #define KEYBOARD_PSR_SX700
+#define KEYBOARD_PSR_SX900
+// #define KEYBOARD_GENOS
+
+// The following compiler directives select how the foot pedals are read.
+// SCAN_PEDAL_PORTS reads all pedals from one snapshot of the AVR input ports per scan, and handles only the changed pedals.
+// Comment out SCAN_PEDAL_PORTS to read each pedal with digitalRead().
+#define SCAN_PEDAL_PORTS
+
+// USE_STATIC_PEDAL_PIN_MAP reads the pedals with StaticButtonsManager, whose pins are given at compile time by FootPedalPinMap in main.cpp.
+// The scan is fully unrolled, and duplicate or invalid pins are compile errors.
+// #define USE_STATIC_PEDAL_PIN_MAP
+
+// READ_PEDALS_FROM_SHIFT_REGISTERS reads NumFootPedalButtons pedals from a chain of 74HC165 shift registers over hardware SPI,
+// instead of from the pedal pins. Comment out SCAN_PEDAL_PORTS when it is defined.
+// #define READ_PEDALS_FROM_SHIFT_REGISTERS
+
+// READ_LADDER_PEDALS adds a board of NumLadderPedals pedals, read through one analog pin (LadderPedalPin) wired as a resistor ladder.
+// The ladder pedals follow the other pedals. It requires SCAN_PEDAL_PORTS; with READ_PEDALS_FROM_SHIFT_REGISTERS,
+// the shift registers' pedals already use all 32 pedal flags.
+// #define READ_LADDER_PEDALS
+
+// READ_EXPRESSION_PEDAL reads an expression pedal on ExpressionPedalPin, and sends its position to the accompaniment channels
+// as Control Change ExpressionControlNumber.
+// #define READ_EXPRESSION_PEDAL
+
+// The following compiler directives link a remote board's pedals to this controller, over the UART.
+// SEND_PEDAL_LINK makes this board the remote board; it sends its pedal bitmap to the main controller, instead of sending MIDI.
+// RECEIVE_PEDAL_LINK makes this board the main controller; the NumLinkedPedals remote pedals follow its own pedals,
+// and act as the pedals at the same position on this board. It requires SCAN_PEDAL_PORTS or READ_PEDALS_FROM_SHIFT_REGISTERS.
+// #define SEND_PEDAL_LINK
+// #define RECEIVE_PEDAL_LINK
+
+// RECEIVE_SYSEX_CONFIG receives configuration SysEx messages on the UART RX (MIDI IN), to change the pedal actions, tempo limits
+// and debounce time without reflashing; see SysExConfigProtocol.h. It cannot be used with the pedal link or SLEEP_WHEN_IDLE.
+// #define RECEIVE_SYSEX_CONFIG
+
+// The following compiler directives select how the foot pedals are debounced.
+// By default, a pedal's state changes immediately, and further changes are ignored for DebounceDelayMs (lockout).
+// DEBOUNCE_VERTICAL_COUNTER debounces all pedals at once with vertical counters sampled every VerticalCounterSampleTickMs.
+// It requires SCAN_PEDAL_PORTS, USE_STATIC_PEDAL_PIN_MAP or READ_PEDALS_FROM_SHIFT_REGISTERS.
+// #define DEBOUNCE_VERTICAL_COUNTER
+
+// ADAPTIVE_DEBOUNCE measures each pedal's bounce time during use, and sets its lockout from its 99th percentile bounce time.
+// The estimates are saved in EEPROM. It requires the lockout, and SCAN_PEDAL_PORTS or READ_PEDALS_FROM_SHIFT_REGISTERS.
+// #define ADAPTIVE_DEBOUNCE
+
+// CAPTURE_PEDAL_EDGES captures pedal edges with pin change interrupts, instead of polling the pedals from loop().
+// Pedal events are handled in the order they occurred, with their capture time. It requires SCAN_PEDAL_PORTS.
+// #define CAPTURE_PEDAL_EDGES
+
+// SCHEDULE_PEDAL_SCANS scans the pedals from a Timer2 interrupt every PedalScanPeriodUs, instead of from loop(),
+// and records the scan period jitter. Pedal events are handled in the order they occurred, with their scan time. It requires SCAN_PEDAL_PORTS.
+// #define SCHEDULE_PEDAL_SCANS
+
+// DETECT_PEDAL_GESTURES detects tap, double tap, long press and hold gestures with PedalGestureEngine, in addition to pedal presses and releases.
+// A hold on a tempo pedal repeats the tempo change.
+// #define DETECT_PEDAL_GESTURES
+
+// DETECT_PEDAL_COMBOS detects pedal combos with PedalComboResolver; pedals pressed together within ComboWindowMs send the combo's action.
+// Presses of combo pedals are held back while a combo is still possible.
+// #define DETECT_PEDAL_COMBOS
+
+// SLEEP_WHEN_IDLE puts the controller into power-down sleep after IdleSleepDelayMs without pedal changes; any pedal change wakes it.
+// The pedals must be on their own pins, and the ADC must be off; it cannot be used with READ_PEDALS_FROM_SHIFT_REGISTERS,
+// READ_LADDER_PEDALS, READ_EXPRESSION_PEDAL, CAPTURE_PEDAL_EDGES or SCHEDULE_PEDAL_SCANS.
+// #define SLEEP_WHEN_IDLE
+
+#if defined(KEYBOARD_PSR_SX700) + defined(KEYBOARD_PSR_SX900) + defined(KEYBOARD_GENOS) != 1
+  #error Exactly one of KEYBOARD_PSR_SX700, KEYBOARD_PSR_SX900 and KEYBOARD_GENOS must be defined.
+#endif
+
+#if defined(READ_LADDER_PEDALS) && defined(READ_PEDALS_FROM_SHIFT_REGISTERS)
+  #error READ_LADDER_PEDALS cannot be used with READ_PEDALS_FROM_SHIFT_REGISTERS; the shift register pedals use all 32 pedal flags.
+#endif
+
+#if defined(READ_LADDER_PEDALS) && !defined(SCAN_PEDAL_PORTS)
+  #error READ_LADDER_PEDALS requires SCAN_PEDAL_PORTS.
+#endif
+
+#if defined(READ_LADDER_PEDALS) && defined(CAPTURE_PEDAL_EDGES)
+  #error READ_LADDER_PEDALS cannot be used with CAPTURE_PEDAL_EDGES.
+#endif
+
+#if defined(READ_PEDALS_FROM_SHIFT_REGISTERS) && (defined(SCAN_PEDAL_PORTS) || defined(USE_STATIC_PEDAL_PIN_MAP))
+  #error READ_PEDALS_FROM_SHIFT_REGISTERS cannot be used with SCAN_PEDAL_PORTS or USE_STATIC_PEDAL_PIN_MAP.
+#endif
+
+#if defined(DEBOUNCE_VERTICAL_COUNTER) && !defined(SCAN_PEDAL_PORTS) && !defined(USE_STATIC_PEDAL_PIN_MAP) && !defined(READ_PEDALS_FROM_SHIFT_REGISTERS)
+  #error DEBOUNCE_VERTICAL_COUNTER requires SCAN_PEDAL_PORTS, USE_STATIC_PEDAL_PIN_MAP or READ_PEDALS_FROM_SHIFT_REGISTERS.
+#endif
+
+#if defined(ADAPTIVE_DEBOUNCE) && (defined(DEBOUNCE_VERTICAL_COUNTER) || defined(USE_STATIC_PEDAL_PIN_MAP) || (!defined(SCAN_PEDAL_PORTS) && !defined(READ_PEDALS_FROM_SHIFT_REGISTERS)))
+  #error ADAPTIVE_DEBOUNCE requires the lockout debounce, and SCAN_PEDAL_PORTS or READ_PEDALS_FROM_SHIFT_REGISTERS.
+#endif
+
+#if defined(CAPTURE_PEDAL_EDGES) && !defined(SCAN_PEDAL_PORTS)
+  #error CAPTURE_PEDAL_EDGES requires SCAN_PEDAL_PORTS.
+#endif
+
+#if defined(CAPTURE_PEDAL_EDGES) && defined(USE_STATIC_PEDAL_PIN_MAP)
+  #error CAPTURE_PEDAL_EDGES is only supported by ButtonsManager; it cannot be used with USE_STATIC_PEDAL_PIN_MAP.
+#endif
+
+#if defined(CAPTURE_PEDAL_EDGES) && defined(DEBOUNCE_VERTICAL_COUNTER)
+  #error CAPTURE_PEDAL_EDGES uses the DebounceDelayMs lockout; it cannot be used with DEBOUNCE_VERTICAL_COUNTER.
+#endif
+
+#if defined(SCHEDULE_PEDAL_SCANS) && (!defined(SCAN_PEDAL_PORTS) || defined(USE_STATIC_PEDAL_PIN_MAP) || defined(DEBOUNCE_VERTICAL_COUNTER) || defined(CAPTURE_PEDAL_EDGES))
+  #error SCHEDULE_PEDAL_SCANS requires SCAN_PEDAL_PORTS, and cannot be used with USE_STATIC_PEDAL_PIN_MAP, DEBOUNCE_VERTICAL_COUNTER or CAPTURE_PEDAL_EDGES.
+#endif
+
+#if defined(SCHEDULE_PEDAL_SCANS) && defined(READ_LADDER_PEDALS)
+  #error READ_LADDER_PEDALS cannot be used with SCHEDULE_PEDAL_SCANS.
+#endif
+
+#if defined(SLEEP_WHEN_IDLE) && (defined(READ_PEDALS_FROM_SHIFT_REGISTERS) || defined(READ_LADDER_PEDALS) || defined(READ_EXPRESSION_PEDAL) || defined(CAPTURE_PEDAL_EDGES) || defined(SCHEDULE_PEDAL_SCANS))
+  #error SLEEP_WHEN_IDLE cannot be used with READ_PEDALS_FROM_SHIFT_REGISTERS, READ_LADDER_PEDALS, READ_EXPRESSION_PEDAL, CAPTURE_PEDAL_EDGES or SCHEDULE_PEDAL_SCANS.
+#endif
+
+#if defined(SEND_PEDAL_LINK) && defined(RECEIVE_PEDAL_LINK)
+  #error SEND_PEDAL_LINK and RECEIVE_PEDAL_LINK cannot both be defined.
+#endif
+
+#if defined(RECEIVE_PEDAL_LINK) && (defined(USE_STATIC_PEDAL_PIN_MAP) || defined(CAPTURE_PEDAL_EDGES) || defined(SCHEDULE_PEDAL_SCANS) || (!defined(SCAN_PEDAL_PORTS) && !defined(READ_PEDALS_FROM_SHIFT_REGISTERS)))
+  #error RECEIVE_PEDAL_LINK requires SCAN_PEDAL_PORTS or READ_PEDALS_FROM_SHIFT_REGISTERS, and cannot be used with USE_STATIC_PEDAL_PIN_MAP, CAPTURE_PEDAL_EDGES or SCHEDULE_PEDAL_SCANS.
+#endif
+
+#if defined(SLEEP_WHEN_IDLE) && (defined(SEND_PEDAL_LINK) || defined(RECEIVE_PEDAL_LINK))
+  #error SLEEP_WHEN_IDLE cannot be used with the pedal link; the UART does not wake the controller, and the link must be refreshed.
+#endif
+
+#if defined(RECEIVE_SYSEX_CONFIG) && (defined(SEND_PEDAL_LINK) || defined(RECEIVE_PEDAL_LINK) || defined(SLEEP_WHEN_IDLE))
+  #error RECEIVE_SYSEX_CONFIG cannot be used with the pedal link, which uses the UART, or SLEEP_WHEN_IDLE, which stops the UART.
+#endif
+
+// The free-running ADC is used by the analog inputs.
+#if defined(READ_LADDER_PEDALS) || defined(READ_EXPRESSION_PEDAL)
+  #define USE_FREE_RUNNING_ADC
+#endif
+
 #endif
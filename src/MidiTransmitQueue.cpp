@@ -0,0 +1,247 @@
+/*******************************************************************************
+  MidiTransmitQueue.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include <Arduino.h>
+
+#include "MidiTransmitQueue.h"
+#include "SharedMacros.h"
+
+const uint8_t MidiTransmitQueue::RingSizes[NumMidiMessagePriorities] = {64, 16, 32, 32};
+const uint8_t MidiTransmitQueue::RingOffsets[NumMidiMessagePriorities] = {0, 64, 80, 112};
+
+void MidiTransmitQueue::Send(MidiMessagePriority priority, const uint8_t* messageBytes, uint8_t numMessageBytes, MidiMessageKey key)
+{
+  if (key == MidiMessageKey::SongBurstMessageKey)
+  {
+    for (uint8_t i = 0; i < NumMidiMessagePriorities; i++)
+    {
+      DropSupersededMessages(i, key);
+    }
+  }
+  else if (key != MidiMessageKey::NoMessageKey)
+  {
+    DropSupersededMessages(priority, key);
+  }
+
+  uint8_t numBytes = MessageHeaderBytes + numMessageBytes;
+  if (numBytes > RingSizes[priority])
+  {
+    // It can never fit; the ring sizes are chosen so this does not happen.
+    DBG_PRINT_LN("MidiTransmitQueue::Send() - Message too long; numMessageBytes = " + String(numMessageBytes) + ".");
+    return;
+  }
+
+  if (GetFreeBytes(priority) < numBytes)
+  {
+    if (mNumBlockedWrites < 0xFFFF)
+    {
+      mNumBlockedWrites++;
+    }
+
+    DBG_PRINT_LN("MidiTransmitQueue::Send() - Blocked writes = " + String(mNumBlockedWrites) + ".");
+
+    // Wait for the UART to drain the queue, as Serial.write() waits for its buffer.
+    while (GetFreeBytes(priority) < numBytes)
+    {
+      Update();
+    }
+  }
+
+  uint16_t sendTimeMs = (uint16_t)millis();
+  PushByte(priority, numMessageBytes);
+  PushByte(priority, key);
+  PushByte(priority, (uint8_t)sendTimeMs);
+  PushByte(priority, (uint8_t)(sendTimeMs >> 8));
+  for (uint8_t i = 0; i < numMessageBytes; i++)
+  {
+    PushByte(priority, messageBytes[i]);
+  }
+
+  if (mNumQueuedBytes > mMaxQueuedBytes)
+  {
+    mMaxQueuedBytes = mNumQueuedBytes;
+  }
+
+  Update();
+}
+
+// A message is started only when a byte of it can be written, so until then a message of a higher class, sent later, goes first,
+// and the queued message can still be dropped.
+void MidiTransmitQueue::Update()
+{
+  int numFreeBytes = Serial.availableForWrite();
+  while (numFreeBytes > 0 && (mActivePriority != NoPriority || StartNextMessage()))
+  {
+    while (numFreeBytes > 0 && mNumActiveBytes > 0)
+    {
+      Serial.write(PopByte(mActivePriority));
+      numFreeBytes--;
+      mNumActiveBytes--;
+    }
+
+    if (mNumActiveBytes == 0)
+    {
+      mActivePriority = NoPriority;
+    }
+  }
+}
+
+bool MidiTransmitQueue::StartNextMessage()
+{
+  uint8_t priority = 0;
+  while (priority < NumMidiMessagePriorities)
+  {
+    if (mRingNumBytes[priority] == 0)
+    {
+      priority++;
+      continue;
+    }
+
+    uint8_t numMessageBytes = PopByte(priority);
+    uint8_t key = PopByte(priority);
+    uint16_t sendTimeMs = PopByte(priority);
+    sendTimeMs |= (uint16_t)PopByte(priority) << 8;
+
+    if (key & DroppedMessageFlag)
+    {
+      for (uint8_t i = 0; i < numMessageBytes; i++)
+      {
+        PopByte(priority);
+      }
+
+      // Look for the next message of this class.
+      continue;
+    }
+
+    mActivePriority = priority;
+    mNumActiveBytes = numMessageBytes;
+
+    // Unsigned subtraction is correct across the 16-bit rollover, for waits shorter than a minute.
+    uint16_t waitMs = (uint16_t)millis() - sendTimeMs;
+    if (waitMs > mMaxWaitMs)
+    {
+      mMaxWaitMs = waitMs;
+      DBG_PRINT_LN("MidiTransmitQueue::StartNextMessage() - Max wait = " + String(mMaxWaitMs) + " ms.");
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+// The queued messages are walked from the oldest; the message being written has no header left in the ring, and is skipped.
+// A switch-off follows its switch-on, so the Main sections whose switch-ons are dropped are kept until their switch-offs are reached.
+void MidiTransmitQueue::DropSupersededMessages(uint8_t priority, MidiMessageKey key)
+{
+  uint8_t droppedSwitchOnMask = 0;
+  uint8_t offset = mActivePriority == priority ? mNumActiveBytes : 0;
+  while (offset < mRingNumBytes[priority])
+  {
+    uint8_t numMessageBytes = mRingBytes[GetRingIndex(priority, offset)];
+    uint8_t keyIndex = GetRingIndex(priority, offset + MessageKeyOffset);
+    uint8_t queuedKey = mRingBytes[keyIndex];
+
+    bool isDropped = false;
+    if (!(queuedKey & DroppedMessageFlag))
+    {
+      if (IsSuperseded(queuedKey, key))
+      {
+        if (IsMainSectionOnKey(queuedKey))
+        {
+          droppedSwitchOnMask |= 1 << (queuedKey - MidiMessageKey::MainSectionOnMessageKey);
+        }
+
+        isDropped = true;
+      }
+      else if (queuedKey >= MidiMessageKey::MainSectionOffMessageKey && queuedKey < MidiMessageKey::SongBurstMessageKey)
+      {
+        // A switch-off is dropped only if its switch-on was.
+        uint8_t sectionBit = 1 << (queuedKey - MidiMessageKey::MainSectionOffMessageKey);
+        isDropped = (droppedSwitchOnMask & sectionBit) != 0;
+        droppedSwitchOnMask &= ~sectionBit;
+      }
+    }
+
+    if (isDropped)
+    {
+      mRingBytes[keyIndex] = queuedKey | DroppedMessageFlag;
+      mNumCoalescedBytes[priority] += numMessageBytes;
+      DBG_PRINT_LN("MidiTransmitQueue::DropSupersededMessages() - priority = " + String(priority) + "; coalesced bytes = " + String(mNumCoalescedBytes[priority]) + ".");
+    }
+
+    offset += MessageHeaderBytes + numMessageBytes;
+  }
+}
+
+bool MidiTransmitQueue::IsSuperseded(uint8_t queuedKey, MidiMessageKey key)
+{
+  if (key == MidiMessageKey::SongBurstMessageKey)
+  {
+    return queuedKey == MidiMessageKey::TempoMessageKey || queuedKey == MidiMessageKey::StyleMessageKey
+      || queuedKey == MidiMessageKey::SongBurstMessageKey || IsMainSectionOnKey(queuedKey);
+  }
+
+  if (IsMainSectionOnKey(key))
+  {
+    return IsMainSectionOnKey(queuedKey);
+  }
+
+  // A switch-off supersedes nothing; its switch-on must be sent.
+  return (key == MidiMessageKey::TempoMessageKey || key == MidiMessageKey::StyleMessageKey) && queuedKey == key;
+}
+
+bool MidiTransmitQueue::IsMainSectionOnKey(uint8_t key)
+{
+  return key >= MidiMessageKey::MainSectionOnMessageKey && key < MidiMessageKey::MainSectionOffMessageKey;
+}
+
+uint8_t MidiTransmitQueue::GetFreeBytes(uint8_t priority) const
+{
+  return RingSizes[priority] - mRingNumBytes[priority];
+}
+
+uint8_t MidiTransmitQueue::GetRingIndex(uint8_t priority, uint8_t offsetFromTail) const
+{
+  return RingOffsets[priority] + ((mRingTails[priority] + offsetFromTail) & (RingSizes[priority] - 1));
+}
+
+void MidiTransmitQueue::PushByte(uint8_t priority, uint8_t value)
+{
+  mRingBytes[RingOffsets[priority] + mRingHeads[priority]] = value;
+  mRingHeads[priority] = (mRingHeads[priority] + 1) & (RingSizes[priority] - 1);
+  mRingNumBytes[priority]++;
+  mNumQueuedBytes++;
+}
+
+uint8_t MidiTransmitQueue::PopByte(uint8_t priority)
+{
+  uint8_t value = mRingBytes[RingOffsets[priority] + mRingTails[priority]];
+  mRingTails[priority] = (mRingTails[priority] + 1) & (RingSizes[priority] - 1);
+  mRingNumBytes[priority]--;
+  mNumQueuedBytes--;
+  return value;
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+  MidiTransmitQueue.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef MidiTransmitQueue_H
+#define MidiTransmitQueue_H
+
+#include <Arduino.h>
+
+// The MidiMessagePriority enum contains the priority classes of the sent MIDI messages, highest first.
+enum MidiMessagePriority
+{
+  // Style Section Control switches, and set list song bursts, which end with one.
+  SectionMessagePriority,
+
+  // Expression Control Changes.
+  ControlMessagePriority,
+
+  // Style selections.
+  StyleMessagePriority,
+
+  // Tempo changes.
+  TempoMessagePriority,
+
+  NumMidiMessagePriorities
+};
+
+// The number of Main sections, A to D, each of which has its own switch-on and switch-off keys.
+const uint8_t NumMainSectionMessageKeys = 4;
+
+// The MidiMessageKey enum contains the coalescing keys of the sent MIDI messages. A queued message that a newer message supersedes,
+// and that has not started to be written, is dropped: a tempo or style selection supersedes the queued ones of its class,
+// and a Main section switch-on supersedes the queued Main section switch-ons, since only the last one selects the section.
+// A queued switch-off is dropped with its switch-on; one whose switch-on was already written is sent, so no switch is left on.
+// A set list song burst selects the style, tempo and section, so it supersedes the queued keyed messages of every class,
+// which would otherwise override it. Messages without a key, e.g., fill-ins, intros and endings, are always sent.
+enum MidiMessageKey
+{
+  NoMessageKey,
+  TempoMessageKey,
+  StyleMessageKey,
+
+  // The Main section keys are MainSectionOnMessageKey or MainSectionOffMessageKey, plus the Main section's offset from Main A.
+  MainSectionOnMessageKey,
+  MainSectionOffMessageKey = MainSectionOnMessageKey + NumMainSectionMessageKeys,
+
+  SongBurstMessageKey = MainSectionOffMessageKey + NumMainSectionMessageKeys
+};
+
+// This class queues the sent MIDI messages, one byte ring per priority class, and feeds them to the UART without blocking.
+// Each call writes only as many bytes as the UART's transmit buffer has room for; the rest are written by later calls.
+// A message is always written whole, so messages are never interleaved; the next message is the oldest message of the highest class.
+// Sending a message that does not fit its class's ring waits for the ring to drain, as Serial.write() would; such writes are counted.
+// A message sent with a key drops the queued messages it supersedes; see MidiMessageKey. The dropped bytes are counted per class.
+class MidiTransmitQueue {
+
+public:
+  // This method queues a message, drops the queued messages it supersedes, and writes as much of the queue as the UART has room for.
+  void Send(MidiMessagePriority priority, const uint8_t* messageBytes, uint8_t numMessageBytes, MidiMessageKey key = MidiMessageKey::NoMessageKey);
+
+  // This method writes as much of the queue as the UART has room for. It must be called from loop().
+  void Update();
+
+  // This method returns true if no message is queued.
+  bool IsIdle() const { return mNumQueuedBytes == 0; }
+
+  // These methods return the largest number of queued bytes, the largest time a message waited before it started to be written,
+  // and the number of messages that had to wait for room in the queue.
+  uint8_t GetMaxQueuedBytes() const { return mMaxQueuedBytes; }
+  uint16_t GetMaxWaitMs() const { return mMaxWaitMs; }
+  uint16_t GetNumBlockedWrites() const { return mNumBlockedWrites; }
+
+  // This method returns the number of message bytes of the priority class that were dropped, because newer messages superseded them.
+  uint16_t GetNumCoalescedBytes(MidiMessagePriority priority) const { return mNumCoalescedBytes[priority]; }
+
+private:
+  // This method starts writing the next message that is not dropped, and returns false if there is none.
+  bool StartNextMessage();
+
+  // This method drops the queued messages of the priority class that a message with the key supersedes,
+  // and the Main section switch-offs whose switch-ons it drops. A set list song burst's key is passed for every class.
+  void DropSupersededMessages(uint8_t priority, MidiMessageKey key);
+
+  // This method returns true if a message with the key supersedes a message with the queued key; switch-offs are not superseded.
+  static bool IsSuperseded(uint8_t queuedKey, MidiMessageKey key);
+
+  // This method returns true if the key is a Main section switch-on key.
+  static bool IsMainSectionOnKey(uint8_t key);
+
+  uint8_t GetFreeBytes(uint8_t priority) const;
+  uint8_t GetRingIndex(uint8_t priority, uint8_t offsetFromTail) const;
+  void PushByte(uint8_t priority, uint8_t value);
+  uint8_t PopByte(uint8_t priority);
+
+private:
+  // Each queued message is preceded by a header: its length, its key, with DroppedMessageFlag set once it is dropped,
+  // and the low 16 bits of its millis() send time.
+  static const uint8_t MessageHeaderBytes = 4;
+  static const uint8_t MessageKeyOffset = 1;
+  static const uint8_t DroppedMessageFlag = 0x80;
+
+  // The ring sizes, which must be powers of two, and their offsets in mRingBytes. The Section ring holds a set list song burst.
+  static const uint8_t RingSizes[NumMidiMessagePriorities];
+  static const uint8_t RingOffsets[NumMidiMessagePriorities];
+  static const uint8_t TotalRingBytes = 64 + 16 + 32 + 32;
+
+  static const uint8_t NoPriority = 0xFF;
+
+  uint8_t mRingBytes[TotalRingBytes];
+  uint8_t mRingHeads[NumMidiMessagePriorities] = {};
+  uint8_t mRingTails[NumMidiMessagePriorities] = {};
+  uint8_t mRingNumBytes[NumMidiMessagePriorities] = {};
+  uint16_t mNumCoalescedBytes[NumMidiMessagePriorities] = {};
+  uint8_t mNumQueuedBytes = 0;
+
+  // The class of the message being written, or NoPriority, and the number of its bytes still to be written.
+  uint8_t mActivePriority = NoPriority;
+  uint8_t mNumActiveBytes = 0;
+
+  uint8_t mMaxQueuedBytes = 0;
+  uint16_t mMaxWaitMs = 0;
+  uint16_t mNumBlockedWrites = 0;
+};
+
+#endif
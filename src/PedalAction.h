@@ -0,0 +1,92 @@
+/*******************************************************************************
+  PedalAction.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalAction_H
+#define PedalAction_H
+
+#include <Arduino.h>
+
+// The PedalActionType enum contains the actions a pedal edge can send.
+enum PedalActionType
+{
+  // Sends nothing.
+  NoAction,
+
+  // Sends Style Section Control switch on or off; param0 is the StyleSectionControlSwitchNum.
+  SectionSwitchOn,
+  SectionSwitchOff,
+
+  // Selects a style; param0 and param1 are the high and low bytes of the StyleNum.
+  SelectStyle,
+
+  // Increments or decrements the tempo. A hold on the pedal repeats them.
+  TempoUp,
+  TempoDown,
+
+  // Selects the next registration bank.
+  NextRegistrationBank,
+
+  // Selects the next or previous song of the set list.
+  NextSong,
+  PreviousSong,
+
+  // The number of action types; not an action.
+  NumPedalActionTypes
+};
+
+// The largest action parameter. The style and section parameters are sent as data bytes of the keyboard's SysEx messages,
+// so they are 7 bits; a byte with the high bit set would be taken as a status byte, and break the message.
+const uint8_t MaxPedalActionParam = 0x7F;
+
+// This struct is a compact pedal action descriptor, stored in flash; 3 bytes per pedal edge.
+struct PedalActionDescriptor
+{
+  uint8_t type;
+  uint8_t param0;
+  uint8_t param1;
+};
+
+// The pedal action table has a press and a release descriptor per pedal.
+enum PedalEdge
+{
+  PressEdge,
+  ReleaseEdge,
+  NumPedalEdges
+};
+
+// This function returns the descriptor of an action with an 8-bit parameter.
+constexpr PedalActionDescriptor MakePedalAction(PedalActionType type, uint8_t param0 = 0)
+{
+  return PedalActionDescriptor{(uint8_t)type, param0, 0};
+}
+
+// This function returns the descriptor of a style selection.
+constexpr PedalActionDescriptor MakeSelectStyleAction(uint16_t styleNum)
+{
+  return PedalActionDescriptor{(uint8_t)PedalActionType::SelectStyle, (uint8_t)(styleNum >> 8), (uint8_t)(styleNum & 0xFF)};
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*******************************************************************************
+  PedalBoards.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+#include "PedalBoards.h"
+
+PedalBoardDescriptor ReadPedalBoard(uint8_t boardIndex)
+{
+  PedalBoardDescriptor pedalBoard;
+  memcpy_P(&pedalBoard, &PedalBoards[boardIndex], sizeof(PedalBoardDescriptor));
+  return pedalBoard;
+}
+
+void SetupPedalBoardButtons(Button* buttons)
+{
+  uint8_t firstButtonIndex = 0;
+  for (uint8_t i = 0; i < NumPedalBoards; i++)
+  {
+    PedalBoardDescriptor pedalBoard = ReadPedalBoard(i);
+    for (uint8_t position = 0; position < pedalBoard.numPedals; position++)
+    {
+      buttons[firstButtonIndex + pedalBoard.logicalPedals[position]].buttonState.pin = pedalBoard.pins[position];
+    }
+
+    firstButtonIndex += pedalBoard.numPedals;
+  }
+}
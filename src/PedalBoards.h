@@ -0,0 +1,131 @@
+/*******************************************************************************
+  PedalBoards.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+#ifndef PedalBoards_H
+#define PedalBoards_H
+
+#include <Arduino.h>
+
+#include "Button.h"
+
+// The pedal boards wired to the Arduino pins, or to the shift registers, are described by the PedalBoards table below.
+// A board is added by adding its descriptor; the button indexes, the pedal counts, the pins and the default pedal actions follow from the table.
+
+// The PedalBoardProfile enum contains the behaviors a pedal board can have. A board's logical pedal N is given its profile's default action N.
+enum PedalBoardProfile
+{
+  // The pedals switch the current style's sections, and send switch on and off; e.g., Main A..D and Ending 1.
+  SectionControlProfile,
+
+  // The pedals select styles, and step the tempo, when pressed.
+  StyleSelectProfile
+};
+
+// The maximum number of pedals on one board.
+const uint8_t MaxPedalBoardPedals = 8;
+
+// This struct describes a pedal board.
+// The pedals are listed in physical order: the back row left to right, then the front row left to right.
+// logicalPedals maps each physical pedal to its logical pedal on the board; logical pedal N of the board is button index GetFirstBoardButtonIndex(board) + N.
+struct PedalBoardDescriptor
+{
+  uint8_t numPedals;
+  uint8_t profile;
+  uint8_t pins[MaxPedalBoardPedals];
+  uint8_t logicalPedals[MaxPedalBoardPedals];
+};
+
+// The PedalBoardIndex enum contains the index of each board in the PedalBoards table below, in the same order.
+enum PedalBoardIndex
+{
+  FivePedalBoard,
+  EightPedalBoard
+};
+
+// The pedal boards, in button index order.
+// When reading pedals from shift registers, pedal N is shift register input N, and the pins are not used.
+constexpr PedalBoardDescriptor PedalBoards[] PROGMEM = {
+  // The Five-Pedal Board (button indexes 0..4).
+  {5, PedalBoardProfile::SectionControlProfile, {2, 3, 4, 5, 6}, {0, 1, 2, 3, 4}},
+
+  // The Eight-Pedal Board (button indexes 5..12); two rows of four pedals. Its last two pedals are wired in swapped order.
+  {8, PedalBoardProfile::StyleSelectProfile, {12, A0, A2, 11, A1, 8, 10, 9}, {0, 1, 2, 3, 4, 5, 7, 6}}
+};
+
+const uint8_t NumPedalBoards = sizeof(PedalBoards) / sizeof(PedalBoards[0]);
+
+static_assert(PedalBoardIndex::EightPedalBoard == NumPedalBoards - 1, "The PedalBoardIndex enum does not match the PedalBoards table.");
+
+// This function returns the number of pedals on the boards from boardIndex on.
+constexpr uint8_t GetNumBoardPedals(uint8_t boardIndex = 0)
+{
+  return boardIndex >= NumPedalBoards ? 0 : PedalBoards[boardIndex].numPedals + GetNumBoardPedals(boardIndex + 1);
+}
+
+// This function returns the button index of the board's logical pedal 0.
+constexpr uint8_t GetFirstBoardButtonIndex(uint8_t boardIndex)
+{
+  return boardIndex == 0 ? 0 : GetFirstBoardButtonIndex(boardIndex - 1) + PedalBoards[boardIndex - 1].numPedals;
+}
+
+// The number of pedals on all boards.
+const uint8_t NumBoardPedals = GetNumBoardPedals();
+
+// This function returns the pin of the pedal at buttonIndex, searching from the board's physical pedal position on; 0xFF if there is none.
+constexpr uint8_t GetBoardPedalPin(uint8_t buttonIndex, uint8_t boardIndex = 0, uint8_t position = 0)
+{
+  return boardIndex >= NumPedalBoards ? 0xFF
+    : position >= PedalBoards[boardIndex].numPedals ? GetBoardPedalPin(buttonIndex, boardIndex + 1, 0)
+    : GetFirstBoardButtonIndex(boardIndex) + PedalBoards[boardIndex].logicalPedals[position] == buttonIndex ? PedalBoards[boardIndex].pins[position]
+    : GetBoardPedalPin(buttonIndex, boardIndex, position + 1);
+}
+
+// This function returns the flags of the board's logical pedals, from its physical pedal position on.
+constexpr uint16_t GetBoardLogicalPedalFlags(uint8_t boardIndex, uint8_t position = 0)
+{
+  return position >= PedalBoards[boardIndex].numPedals ? 0
+    : (uint16_t)(1 << PedalBoards[boardIndex].logicalPedals[position]) | GetBoardLogicalPedalFlags(boardIndex, position + 1);
+}
+
+// This function returns true if every board from boardIndex on fits MaxPedalBoardPedals, and maps its physical pedals one-to-one onto its logical pedals.
+constexpr bool ArePedalBoardsValid(uint8_t boardIndex = 0)
+{
+  return boardIndex >= NumPedalBoards
+    || (PedalBoards[boardIndex].numPedals <= MaxPedalBoardPedals
+      && GetBoardLogicalPedalFlags(boardIndex) == (uint16_t)((1 << PedalBoards[boardIndex].numPedals) - 1)
+      && ArePedalBoardsValid(boardIndex + 1));
+}
+
+static_assert(ArePedalBoardsValid(), "A pedal board has too many pedals, or its logical pedals are not one per physical pedal.");
+
+// This function reads board boardIndex's descriptor from flash.
+PedalBoardDescriptor ReadPedalBoard(uint8_t boardIndex);
+
+// This function sets the pins of the board pedals in buttons, which is in button index order.
+void SetupPedalBoardButtons(Button* buttons);
+
+#endif
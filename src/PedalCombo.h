@@ -0,0 +1,68 @@
+/*******************************************************************************
+  PedalCombo.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalCombo_H
+#define PedalCombo_H
+
+#include <Arduino.h>
+
+#include "PedalBoards.h"
+#include "PedalFlags.h"
+
+// The PedalComboAction enum contains the actions sent when a pedal combo is pressed.
+enum PedalComboAction
+{
+  // Resets the tempo to DefaultTempo.
+  ResetTempo,
+
+  // Sends Ending 2.
+  SendEnding2,
+
+  // Selects the next registration bank.
+  SelectNextBank
+};
+
+// This struct is a pedal combo; pressing all of its pedals within ComboWindowMs sends its action.
+struct PedalCombo
+{
+  PedalFlags pedalFlags;
+  uint8_t action;
+};
+
+// This function returns the pedal flag of the board's logical pedal; 0 if the board has no such pedal.
+constexpr PedalFlags GetBoardPedalFlag(uint8_t boardIndex, uint8_t logicalPedal)
+{
+  return boardIndex >= NumPedalBoards || logicalPedal >= PedalBoards[boardIndex].numPedals ? 0
+    : (PedalFlags)1 << (GetFirstBoardButtonIndex(boardIndex) + logicalPedal);
+}
+
+// This function returns the descriptor of a combo of two pedals, each given by its board and its logical pedal on the board.
+constexpr PedalCombo MakePedalCombo(uint8_t boardIndex0, uint8_t logicalPedal0, uint8_t boardIndex1, uint8_t logicalPedal1, PedalComboAction action)
+{
+  return PedalCombo{(PedalFlags)(GetBoardPedalFlag(boardIndex0, logicalPedal0) | GetBoardPedalFlag(boardIndex1, logicalPedal1)), (uint8_t)action};
+}
+
+#endif
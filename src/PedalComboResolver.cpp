@@ -0,0 +1,175 @@
+/*******************************************************************************
+  PedalComboResolver.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "MidiAccompanimentController.h"
+
+// Do not build unless detecting combos.
+#ifdef DETECT_PEDAL_COMBOS
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+#include "PedalComboResolver.h"
+#include "FootPedalSwitchChangeManager.h"
+#include "SharedMacros.h"
+
+// The pedal combos, by board and logical pedal. The Eight-Pedal Board's logical pedals 3 and 7 are the tempo pedals,
+// and the Five-Pedal Board's logical pedals 0 and 4 are MainA and Ending 1. The bank combo reuses combo pedals, so it holds back no other pedal's presses.
+constexpr PedalCombo PedalCombos[] PROGMEM = {
+  MakePedalCombo(PedalBoardIndex::EightPedalBoard, 3, PedalBoardIndex::EightPedalBoard, 7, PedalComboAction::ResetTempo),
+  MakePedalCombo(PedalBoardIndex::FivePedalBoard, 0, PedalBoardIndex::FivePedalBoard, 4, PedalComboAction::SendEnding2),
+  MakePedalCombo(PedalBoardIndex::FivePedalBoard, 4, PedalBoardIndex::EightPedalBoard, 7, PedalComboAction::SelectNextBank)
+};
+
+// This function returns true if every combo from comboIndex on has two different pedals, each on a board.
+constexpr bool ArePedalCombosValid(uint8_t comboIndex = 0)
+{
+  return comboIndex >= COUNT_ENTRIES(PedalCombos)
+    || ((PedalCombos[comboIndex].pedalFlags & (PedalCombos[comboIndex].pedalFlags - 1)) != 0 && ArePedalCombosValid(comboIndex + 1));
+}
+
+static_assert(ArePedalCombosValid(), "A pedal combo has a pedal that is not on its board, or the same pedal twice.");
+
+// This function reads combo comboIndex from flash.
+static PedalCombo ReadPedalCombo(uint8_t comboIndex)
+{
+  PedalCombo pedalCombo;
+  memcpy_P(&pedalCombo, &PedalCombos[comboIndex], sizeof(PedalCombo));
+  return pedalCombo;
+}
+
+PedalComboResolver::PedalComboResolver(FootPedalSwitchChangeManager& footPedalSwitchChangeManager) :
+  mFootPedalSwitchChangeManager(footPedalSwitchChangeManager)
+{
+  for (uint8_t i = 0; i < COUNT_ENTRIES(PedalCombos); i++)
+  {
+    mComboPedalFlags |= ReadPedalCombo(i).pedalFlags;
+  }
+}
+
+void PedalComboResolver::OnButtonChange(byte buttonIndex, bool isActive)
+{
+  PedalFlags buttonFlag = (PedalFlags)1 << buttonIndex;
+
+  if (isActive)
+  {
+    if ((buttonFlag & mComboPedalFlags) == 0)
+    {
+      mFootPedalSwitchChangeManager.HandleButtonChange(buttonIndex, true);
+      return;
+    }
+
+    if (mPendingPedalFlags == 0)
+    {
+      mPendingStartTimeMs = millis();
+    }
+
+    mPendingPedalFlags |= buttonFlag;
+    Resolve();
+    return;
+  }
+
+  if ((buttonFlag & mConsumedPedalFlags) != 0)
+  {
+    mConsumedPedalFlags &= ~buttonFlag;
+    return;
+  }
+
+  if ((buttonFlag & mPendingPedalFlags) != 0)
+  {
+    // The pedal was released before its combo completed; it is a single pedal press.
+    SendPendingPresses();
+  }
+
+  mFootPedalSwitchChangeManager.HandleButtonChange(buttonIndex, false);
+}
+
+void PedalComboResolver::Update()
+{
+  // Unsigned subtraction is correct across the millis() rollover.
+  if (mPendingPedalFlags != 0 && millis() - mPendingStartTimeMs >= ComboWindowMs)
+  {
+    SendPendingPresses();
+  }
+}
+
+void PedalComboResolver::Resolve()
+{
+  bool isComboPossible = false;
+  for (uint8_t i = 0; i < COUNT_ENTRIES(PedalCombos); i++)
+  {
+    PedalCombo pedalCombo = ReadPedalCombo(i);
+
+    if (pedalCombo.pedalFlags == mPendingPedalFlags)
+    {
+      UpdateAddedLatency(millis());
+      mConsumedPedalFlags |= mPendingPedalFlags;
+      mPendingPedalFlags = 0;
+      mFootPedalSwitchChangeManager.HandleCombo((PedalComboAction)pedalCombo.action);
+      return;
+    }
+
+    if ((pedalCombo.pedalFlags & mPendingPedalFlags) == mPendingPedalFlags)
+    {
+      isComboPossible = true;
+    }
+  }
+
+  if (!isComboPossible)
+  {
+    SendPendingPresses();
+  }
+}
+
+void PedalComboResolver::SendPendingPresses()
+{
+  UpdateAddedLatency(millis());
+
+  PedalFlags pendingPedalFlags = mPendingPedalFlags;
+  mPendingPedalFlags = 0;
+
+  PedalFlags buttonFlag = 1;
+  for (byte i = 0; pendingPedalFlags != 0; i++, buttonFlag <<= 1)
+  {
+    if ((pendingPedalFlags & buttonFlag) != 0)
+    {
+      pendingPedalFlags &= ~buttonFlag;
+      mFootPedalSwitchChangeManager.HandleButtonChange(i, true);
+    }
+  }
+}
+
+void PedalComboResolver::UpdateAddedLatency(unsigned long curTimeMs)
+{
+  unsigned long addedLatencyMs = curTimeMs - mPendingStartTimeMs;
+  if (addedLatencyMs > mMaxAddedLatencyMs)
+  {
+    mMaxAddedLatencyMs = addedLatencyMs;
+    DBG_PRINT_LN("PedalComboResolver::UpdateAddedLatency() - Max added latency = " + String(mMaxAddedLatencyMs) + " ms.");
+  }
+}
+
+#endif // DETECT_PEDAL_COMBOS
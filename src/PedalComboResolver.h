@@ -0,0 +1,91 @@
+/*******************************************************************************
+  PedalComboResolver.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalComboResolver_H
+#define PedalComboResolver_H
+
+#include <Arduino.h>
+
+#include "PedalCombo.h"
+#include "PedalFlags.h"
+#include "SharedConstants.h"
+
+class FootPedalSwitchChangeManager;
+
+// This class detects pedal combos, from the combo table in flash.
+// A press of a pedal that is not in any combo is sent immediately.
+// A press of a combo pedal is held back only while a combo is still possible; that is, until a combo matches,
+// the pressed pedals cannot be part of any combo, a held back pedal is released, or ComboWindowMs elapses.
+// The added latency is therefore at most ComboWindowMs plus one loop() period; the largest measured value is kept.
+class PedalComboResolver {
+
+public:
+  // This method is the constructor. Presses, releases and combos are sent to the Foot Pedal Switch Change Manager passed in.
+  PedalComboResolver(FootPedalSwitchChangeManager& footPedalSwitchChangeManager);
+
+  // This method handles a pedal press or release.
+  void OnButtonChange(byte buttonIndex, bool isActive);
+
+  // This method must be called from loop(), to send the held back presses once the combo window has elapsed.
+  void Update();
+
+  // This method returns the largest time a press was held back, in milliseconds.
+  unsigned long GetMaxAddedLatencyMs() const { return mMaxAddedLatencyMs; }
+
+  // This method returns the pedals of the sent combos that are still pressed.
+  PedalFlags GetConsumedPedalFlags() const { return mConsumedPedalFlags; }
+
+  // This method returns true if no press is held back.
+  bool IsIdle() const { return mPendingPedalFlags == 0; }
+
+private:
+  // This method sends the combo's action if the held back pedals match a combo exactly,
+  // or sends the held back presses if they cannot be part of any combo.
+  void Resolve();
+
+  // This method sends the held back presses, in button index order.
+  void SendPendingPresses();
+
+  // This method updates the largest added latency, given the time the held back presses are sent.
+  void UpdateAddedLatency(unsigned long curTimeMs);
+
+private:
+  FootPedalSwitchChangeManager& mFootPedalSwitchChangeManager;
+
+  // The pedals that are in at least one combo.
+  PedalFlags mComboPedalFlags = 0;
+
+  // The combo pedals that are pressed, and held back.
+  PedalFlags mPendingPedalFlags = 0;
+
+  // The pedals of a sent combo; their releases are not sent.
+  PedalFlags mConsumedPedalFlags = 0;
+
+  unsigned long mPendingStartTimeMs = 0;
+  unsigned long mMaxAddedLatencyMs = 0;
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*******************************************************************************
+  PedalConfig.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalConfig_H
+#define PedalConfig_H
+
+#include <Arduino.h>
+
+#include "PedalAction.h"
+#include "PedalBoards.h"
+
+// The number of pedals whose actions are configurable; the pedals of the pedal boards.
+const uint8_t NumConfigurablePedals = NumBoardPedals;
+
+// This struct is the pedal configuration: the pedal action table, the tempo limits, and the debounce time.
+// It is stored in EEPROM by PedalConfigStore, and used from a RAM image; its layout is the EEPROM format.
+struct PedalConfig
+{
+  PedalActionDescriptor pedalActions[NumConfigurablePedals][PedalEdge::NumPedalEdges];
+  uint8_t defaultTempo;
+  uint8_t minTempo;
+  uint8_t maxTempo;
+
+  // The lockout debounce time, in milliseconds; the vertical counter and adaptive debouncers do not use it.
+  uint8_t debounceDelayMs;
+};
+
+#endif
@@ -0,0 +1,102 @@
+/*******************************************************************************
+  PedalConfigStore.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include <Arduino.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+
+#include "PedalConfigStore.h"
+#include "EepromLayout.h"
+#include "KeyboardProfiles/KeyboardProfile.h"
+#include "SharedMacros.h"
+
+bool PedalConfigStore::Load(PedalConfig& pedalConfig)
+{
+  if (eeprom_read_byte((const uint8_t*)EepromPedalConfigAddress) != EepromPedalConfigVersion)
+  {
+    return false;
+  }
+
+  eeprom_read_block(&pedalConfig, (const void*)(EepromPedalConfigAddress + 1), sizeof(PedalConfig));
+
+  uint16_t storedCrc;
+  eeprom_read_block(&storedCrc, (const void*)(EepromPedalConfigAddress + 1 + sizeof(PedalConfig)), sizeof(storedCrc));
+
+  return storedCrc == GetCrc(pedalConfig) && IsValid(pedalConfig);
+}
+
+void PedalConfigStore::Save(const PedalConfig& pedalConfig)
+{
+  // Invalidate the block first, so a reset while saving leaves a block that fails to load, rather than a mix of old and new bytes.
+  eeprom_update_byte((uint8_t*)EepromPedalConfigAddress, 0xFF);
+
+  uint16_t crc = GetCrc(pedalConfig);
+  eeprom_update_block(&pedalConfig, (void*)(EepromPedalConfigAddress + 1), sizeof(PedalConfig));
+  eeprom_update_block(&crc, (void*)(EepromPedalConfigAddress + 1 + sizeof(PedalConfig)), sizeof(crc));
+
+  eeprom_update_byte((uint8_t*)EepromPedalConfigAddress, EepromPedalConfigVersion);
+}
+
+bool PedalConfigStore::IsValid(const PedalConfig& pedalConfig)
+{
+  if (pedalConfig.minTempo < KeyboardMinTempo || pedalConfig.minTempo > pedalConfig.defaultTempo || pedalConfig.defaultTempo > pedalConfig.maxTempo || pedalConfig.maxTempo > MaxConfigTempo)
+  {
+    return false;
+  }
+
+  if (pedalConfig.debounceDelayMs == 0 || pedalConfig.debounceDelayMs > MaxDebounceDelayMs)
+  {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < NumConfigurablePedals; i++)
+  {
+    for (uint8_t edge = 0; edge < PedalEdge::NumPedalEdges; edge++)
+    {
+      const PedalActionDescriptor& action = pedalConfig.pedalActions[i][edge];
+      if (action.type >= PedalActionType::NumPedalActionTypes || action.param0 > MaxPedalActionParam || action.param1 > MaxPedalActionParam)
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// The CRC covers the version byte and the configuration.
+uint16_t PedalConfigStore::GetCrc(const PedalConfig& pedalConfig)
+{
+  uint16_t crc = _crc16_update(0xFFFF, EepromPedalConfigVersion);
+
+  const uint8_t* bytes = (const uint8_t*)&pedalConfig;
+  for (uint8_t i = 0; i < sizeof(PedalConfig); i++)
+  {
+    crc = _crc16_update(crc, bytes[i]);
+  }
+
+  return crc;
+}
@@ -0,0 +1,52 @@
+/*******************************************************************************
+  PedalConfigStore.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalConfigStore_H
+#define PedalConfigStore_H
+
+#include <Arduino.h>
+
+#include "PedalConfig.h"
+
+// This class loads and saves the pedal configuration in EEPROM, as a block with a version byte and a CRC-16.
+class PedalConfigStore {
+
+public:
+  // This method reads the pedal configuration from EEPROM into the RAM image passed in.
+  // It returns false, and leaves the image unspecified, if the block's version or CRC is wrong, or its values are invalid.
+  static bool Load(PedalConfig& pedalConfig);
+
+  // This method writes the pedal configuration to EEPROM. Only changed bytes are written.
+  static void Save(const PedalConfig& pedalConfig);
+
+  // This method returns true if the pedal configuration's values are valid.
+  static bool IsValid(const PedalConfig& pedalConfig);
+
+  // This method returns the CRC-16 stored after the pedal configuration.
+  static uint16_t GetCrc(const PedalConfig& pedalConfig);
+};
+
+#endif
@@ -0,0 +1,45 @@
+/*******************************************************************************
+  PedalFlags.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalFlags_H
+#define PedalFlags_H
+
+#include <Arduino.h>
+
+#include "MidiAccompanimentController.h"
+#include "SharedConstants.h"
+
+// The PedalFlags type holds one bit per foot pedal button; bit N corresponds to gFootPedalButtons[N].
+// A set bit indicates the pedal is pressed.
+#if defined(READ_PEDALS_FROM_SHIFT_REGISTERS) || defined(READ_LADDER_PEDALS) || defined(RECEIVE_PEDAL_LINK)
+typedef uint32_t PedalFlags;
+#else
+typedef uint16_t PedalFlags;
+#endif
+
+static_assert(NumFootPedalButtons <= sizeof(PedalFlags) * 8, "PedalFlags has fewer bits than NumFootPedalButtons.");
+
+#endif
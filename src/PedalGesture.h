@@ -0,0 +1,46 @@
+/*******************************************************************************
+  PedalGesture.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalGesture_H
+#define PedalGesture_H
+
+// The PedalGesture enum contains the gestures detected by PedalGestureEngine.
+enum PedalGesture
+{
+  // Pressed and released, with no second press within DoubleTapWindowMs. Sent when the double tap window ends.
+  Tap,
+
+  // Pressed again within DoubleTapWindowMs after a tap. Sent on the second press.
+  DoubleTap,
+
+  // Held for LongPressMs. Sent once, while still held.
+  LongPress,
+
+  // Still held after a long press. Sent every HoldRepeatMs until released.
+  Hold
+};
+
+#endif
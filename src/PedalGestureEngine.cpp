@@ -0,0 +1,243 @@
+/*******************************************************************************
+  PedalGestureEngine.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "MidiAccompanimentController.h"
+
+// Do not build unless detecting gestures.
+#ifdef DETECT_PEDAL_GESTURES
+
+#include <Arduino.h>
+
+#include "PedalGestureEngine.h"
+#include "SharedMacros.h"
+
+// A pedal's timer slot is NoTimerSlot when its timer is not running.
+static const uint8_t NoTimerSlot = 0xFF;
+
+PedalGestureEngine::PedalGestureEngine(FootPedalGestureHandler& gestureHandler) :
+  mGestureHandler(gestureHandler),
+  mLastTickTimeMs(millis())
+{
+  for (uint8_t i = 0; i < NumGestureWheelSlots; i++)
+  {
+    mSlotTimers[i] = NoButtonIndex;
+  }
+
+  for (uint8_t i = 0; i < NumFootPedalButtons; i++)
+  {
+    mGestureStates[i] = PedalGestureState::Idle;
+    mTimerSlots[i] = NoTimerSlot;
+  }
+}
+
+void PedalGestureEngine::OnButtonChange(byte buttonIndex, bool isActive)
+{
+  if (buttonIndex >= NumFootPedalButtons)
+  {
+    return;
+  }
+
+  switch (mGestureStates[buttonIndex])
+  {
+    case PedalGestureState::Idle:
+      if (isActive)
+      {
+        mGestureStates[buttonIndex] = PedalGestureState::Pressed;
+        StartTimer(buttonIndex, LongPressMs);
+      }
+
+      break;
+
+    case PedalGestureState::Pressed:
+      if (!isActive)
+      {
+        // Released before a long press; wait for a second tap.
+        mGestureStates[buttonIndex] = PedalGestureState::WaitingForSecondTap;
+        StartTimer(buttonIndex, DoubleTapWindowMs);
+      }
+
+      break;
+
+    case PedalGestureState::WaitingForSecondTap:
+      if (isActive)
+      {
+        CancelTimer(buttonIndex);
+        mGestureStates[buttonIndex] = PedalGestureState::SecondPressed;
+        mGestureHandler.HandleGesture(buttonIndex, PedalGesture::DoubleTap);
+      }
+
+      break;
+
+    case PedalGestureState::SecondPressed:
+    case PedalGestureState::LongPressed:
+      if (!isActive)
+      {
+        CancelTimer(buttonIndex);
+        mGestureStates[buttonIndex] = PedalGestureState::Idle;
+      }
+
+      break;
+  }
+}
+
+void PedalGestureEngine::CancelPedal(byte buttonIndex)
+{
+  if (buttonIndex >= NumFootPedalButtons)
+  {
+    return;
+  }
+
+  CancelTimer(buttonIndex);
+  mGestureStates[buttonIndex] = PedalGestureState::Idle;
+}
+
+void PedalGestureEngine::Update()
+{
+  // Unsigned subtraction is correct across the millis() rollover.
+  uint32_t curTimeMs = millis();
+  while (curTimeMs - mLastTickTimeMs >= GestureTickMs)
+  {
+    mLastTickTimeMs += GestureTickMs;
+
+    mCurSlot++;
+    if (mCurSlot >= NumGestureWheelSlots)
+    {
+      mCurSlot = 0;
+    }
+
+    uint8_t buttonIndex = mSlotTimers[mCurSlot];
+    while (buttonIndex != NoButtonIndex)
+    {
+      // The expired timer's handler may start a new timer; get the next timer first.
+      uint8_t nextButtonIndex = mNextTimers[buttonIndex];
+
+      if (mTimerRounds[buttonIndex] > 0)
+      {
+        mTimerRounds[buttonIndex]--;
+      }
+      else
+      {
+        CancelTimer(buttonIndex);
+        OnTimerExpired(buttonIndex);
+      }
+
+      buttonIndex = nextButtonIndex;
+    }
+  }
+}
+
+bool PedalGestureEngine::IsIdle() const
+{
+  for (uint8_t i = 0; i < NumGestureWheelSlots; i++)
+  {
+    if (mSlotTimers[i] != NoButtonIndex)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void PedalGestureEngine::StartTimer(uint8_t buttonIndex, uint16_t timeoutMs)
+{
+  CancelTimer(buttonIndex);
+
+  uint16_t numTicks = (timeoutMs + GestureTickMs - 1) / GestureTickMs;
+  if (numTicks == 0)
+  {
+    numTicks = 1;
+  }
+
+  uint8_t slot = (mCurSlot + numTicks) % NumGestureWheelSlots;
+  mTimerSlots[buttonIndex] = slot;
+  mTimerRounds[buttonIndex] = (numTicks - 1) / NumGestureWheelSlots;
+
+  // Insert at the head of the slot's list.
+  mPrevTimers[buttonIndex] = NoButtonIndex;
+  mNextTimers[buttonIndex] = mSlotTimers[slot];
+  if (mSlotTimers[slot] != NoButtonIndex)
+  {
+    mPrevTimers[mSlotTimers[slot]] = buttonIndex;
+  }
+
+  mSlotTimers[slot] = buttonIndex;
+}
+
+void PedalGestureEngine::CancelTimer(uint8_t buttonIndex)
+{
+  uint8_t slot = mTimerSlots[buttonIndex];
+  if (slot == NoTimerSlot)
+  {
+    return;
+  }
+
+  uint8_t prevButtonIndex = mPrevTimers[buttonIndex];
+  uint8_t nextButtonIndex = mNextTimers[buttonIndex];
+
+  if (prevButtonIndex == NoButtonIndex)
+  {
+    mSlotTimers[slot] = nextButtonIndex;
+  }
+  else
+  {
+    mNextTimers[prevButtonIndex] = nextButtonIndex;
+  }
+
+  if (nextButtonIndex != NoButtonIndex)
+  {
+    mPrevTimers[nextButtonIndex] = prevButtonIndex;
+  }
+
+  mTimerSlots[buttonIndex] = NoTimerSlot;
+}
+
+void PedalGestureEngine::OnTimerExpired(uint8_t buttonIndex)
+{
+  switch (mGestureStates[buttonIndex])
+  {
+    case PedalGestureState::Pressed:
+      mGestureStates[buttonIndex] = PedalGestureState::LongPressed;
+      StartTimer(buttonIndex, HoldRepeatMs);
+      mGestureHandler.HandleGesture(buttonIndex, PedalGesture::LongPress);
+      break;
+
+    case PedalGestureState::LongPressed:
+      StartTimer(buttonIndex, HoldRepeatMs);
+      mGestureHandler.HandleGesture(buttonIndex, PedalGesture::Hold);
+      break;
+
+    case PedalGestureState::WaitingForSecondTap:
+      mGestureStates[buttonIndex] = PedalGestureState::Idle;
+      mGestureHandler.HandleGesture(buttonIndex, PedalGesture::Tap);
+      break;
+
+    default:
+      break;
+  }
+}
+
+#endif // DETECT_PEDAL_GESTURES
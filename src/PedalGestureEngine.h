@@ -0,0 +1,101 @@
+/*******************************************************************************
+  PedalGestureEngine.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalGestureEngine_H
+#define PedalGestureEngine_H
+
+#include <Arduino.h>
+
+#include "MidiAccompanimentController.h"
+#include "PedalGesture.h"
+#include "SharedConstants.h"
+#include "GestureHandlers/FootPedalGestureHandler.h"
+
+// This class detects tap, double tap, long press and hold gestures from pedal presses and releases.
+// Presses and releases are still handled immediately as button changes; gestures are sent to the gesture handler in addition.
+// Gesture timeouts are kept in a timer wheel of NumGestureWheelSlots slots, GestureTickMs apart, with at most one timer per pedal.
+// Starting or cancelling a timer is O(1), and each tick only visits the timers in one slot. There is no heap use, and no call to delay().
+class PedalGestureEngine {
+
+public:
+  // This method is the constructor. Gestures are sent to the gesture handler passed in. The wheel's first tick is GestureTickMs after construction.
+  PedalGestureEngine(FootPedalGestureHandler& gestureHandler);
+
+  // This method tracks a pedal press or release.
+  void OnButtonChange(byte buttonIndex, bool isActive);
+
+  // This method cancels the pedal's gesture and its timer, e.g., when its press is part of a combo.
+  // The pedal sends no gesture until it is pressed again.
+  void CancelPedal(byte buttonIndex);
+
+  // This method must be called from loop(), to advance the timer wheel.
+  void Update();
+
+  // This method returns true if no gesture timer is running.
+  bool IsIdle() const;
+
+private:
+  // The PedalGestureState enum contains the state of a pedal's gesture.
+  enum PedalGestureState
+  {
+    Idle,
+    Pressed,
+    WaitingForSecondTap,
+    SecondPressed,
+    LongPressed
+  };
+
+  // This method starts the pedal's timer, which expires after timeoutMs.
+  void StartTimer(uint8_t buttonIndex, uint16_t timeoutMs);
+
+  // This method cancels the pedal's timer, if it is running.
+  void CancelTimer(uint8_t buttonIndex);
+
+  // This method handles the expiry of the pedal's timer.
+  void OnTimerExpired(uint8_t buttonIndex);
+
+private:
+  static const uint8_t NoButtonIndex = 0xFF;
+
+  FootPedalGestureHandler& mGestureHandler;
+
+  uint8_t mGestureStates[NumFootPedalButtons];
+
+  // The timer wheel. Each slot is a doubly linked list of pedals, linked through mNextTimers and mPrevTimers.
+  // A pedal's timer expires when the wheel reaches its slot with mTimerRounds at 0.
+  uint8_t mSlotTimers[NumGestureWheelSlots];
+  uint8_t mNextTimers[NumFootPedalButtons];
+  uint8_t mPrevTimers[NumFootPedalButtons];
+  uint8_t mTimerSlots[NumFootPedalButtons];
+  uint8_t mTimerRounds[NumFootPedalButtons];
+
+  uint8_t mCurSlot = 0;
+
+  // The time of the last tick. It is a uint32_t, as millis() is, so the rollover arithmetic is the same on any host.
+  uint32_t mLastTickTimeMs = 0;
+};
+
+#endif
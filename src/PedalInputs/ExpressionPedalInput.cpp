@@ -0,0 +1,128 @@
+/*******************************************************************************
+  ExpressionPedalInput.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless reading the expression pedal.
+#ifdef READ_EXPRESSION_PEDAL
+
+#include <Arduino.h>
+
+#include "ExpressionPedalInput.h"
+
+#include "../SharedMacros.h"
+
+// The ADC counts per 7-bit value.
+static const uint16_t ExpressionStep = 1024 / 128;
+
+static_assert(ExpressionOversampleCount * 1023UL <= 0xFFFF, "ExpressionOversampleCount samples must fit in 16 bits.");
+
+ExpressionPedalInput::ExpressionPedalInput()
+{
+}
+
+void ExpressionPedalInput::Setup(FreeRunningAdc& freeRunningAdc)
+{
+  mFreeRunningAdc = &freeRunningAdc;
+  mAdcChannel = freeRunningAdc.AddChannel(ExpressionPedalPin);
+  mLastSampleCount = freeRunningAdc.GetSampleCount(mAdcChannel);
+}
+
+bool ExpressionPedalInput::Update(uint8_t& value)
+{
+  uint8_t sampleCount = mFreeRunningAdc->GetSampleCount(mAdcChannel);
+  if (sampleCount != mLastSampleCount)
+  {
+    // Only the latest sample is stored; samples taken while loop() was busy are skipped, which does not bias the average.
+    mLastSampleCount = sampleCount;
+    mSampleSum += mFreeRunningAdc->GetSample(mAdcChannel);
+
+    if (++mNumSummedSamples >= ExpressionOversampleCount)
+    {
+      FilterReading(mSampleSum / ExpressionOversampleCount);
+      mSampleSum = 0;
+      mNumSummedSamples = 0;
+    }
+  }
+
+  // Nothing is sent until the first reading; mSentValue starts out of range, so the first value is sent.
+  if (!mHasReading || mValue == mSentValue)
+  {
+    return false;
+  }
+
+  // Unsigned subtraction is correct across the millis() rollover.
+  unsigned long curTimeMs = millis();
+  if (mHasSentValue && curTimeMs - mLastSendTimeMs < ExpressionMinSendIntervalMs)
+  {
+    return false;
+  }
+
+  mLastSendTimeMs = curTimeMs;
+  mSentValue = mValue;
+  mHasSentValue = true;
+  if (mNumSentValues < 0xFFFF)
+  {
+    mNumSentValues++;
+  }
+
+  value = mValue;
+  return true;
+}
+
+uint8_t ExpressionPedalInput::FilterReading(uint16_t reading)
+{
+  if (mNumReadings < 0xFFFF)
+  {
+    mNumReadings++;
+  }
+
+  if (!mHasReading)
+  {
+    mHasReading = true;
+    mValue = reading / ExpressionStep;
+    mNumValueChanges++;
+    return mValue;
+  }
+
+  // Stay at the current value while the reading is within its band, widened by the hysteresis.
+  uint16_t bandStart = mValue * ExpressionStep;
+  uint16_t bandEnd = bandStart + ExpressionStep - 1;
+  if (reading + ExpressionHysteresis >= bandStart && reading <= bandEnd + ExpressionHysteresis)
+  {
+    return mValue;
+  }
+
+  mValue = reading / ExpressionStep;
+  if (mNumValueChanges < 0xFFFF)
+  {
+    mNumValueChanges++;
+  }
+
+  return mValue;
+}
+
+#endif // READ_EXPRESSION_PEDAL
@@ -0,0 +1,82 @@
+/*******************************************************************************
+  ExpressionPedalInput.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef ExpressionPedalInput_H
+#define ExpressionPedalInput_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../SharedConstants.h"
+#include "FreeRunningAdc.h"
+
+// This class reads an expression pedal (a potentiometer) on ExpressionPedalPin, and reports its position as a 7-bit MIDI value.
+// The samples are taken by FreeRunningAdc. Each reading is the average of ExpressionOversampleCount samples;
+// its value changes only when the reading leaves the current value's band by ExpressionHysteresis ADC counts,
+// and a changed value is reported at most every ExpressionMinSendIntervalMs, so a sweeping pedal cannot saturate the MIDI link.
+// The last value is always reported once the interval has elapsed.
+class ExpressionPedalInput {
+
+public:
+  // This method is the default constructor.
+  ExpressionPedalInput();
+
+  // This method adds the expression pedal pin to the free-running ADC.
+  void Setup(FreeRunningAdc& freeRunningAdc);
+
+  // This method must be called from loop(). It returns true, and sets value, when a changed value is due to be sent.
+  bool Update(uint8_t& value);
+
+  // This method filters one averaged reading (0..1023), and returns the 7-bit value.
+  uint8_t FilterReading(uint16_t reading);
+
+  // This method returns the number of readings, value changes, and sent values, up to 65535; they show how much is suppressed.
+  uint16_t GetNumReadings() const { return mNumReadings; }
+  uint16_t GetNumValueChanges() const { return mNumValueChanges; }
+  uint16_t GetNumSentValues() const { return mNumSentValues; }
+
+private:
+  FreeRunningAdc* mFreeRunningAdc = NULL;
+  uint8_t mAdcChannel = 0;
+  uint8_t mLastSampleCount = 0;
+
+  uint16_t mSampleSum = 0;
+  uint8_t mNumSummedSamples = 0;
+
+  // Whether a reading has been filtered, and a value sent, since startup.
+  bool mHasReading = false;
+  bool mHasSentValue = false;
+
+  uint8_t mValue = 0;
+  uint8_t mSentValue = 0xFF;
+  unsigned long mLastSendTimeMs = 0;
+
+  uint16_t mNumReadings = 0;
+  uint16_t mNumValueChanges = 0;
+  uint16_t mNumSentValues = 0;
+};
+
+#endif
@@ -0,0 +1,124 @@
+/*******************************************************************************
+  FreeRunningAdc.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless the ADC is used.
+#ifdef USE_FREE_RUNNING_ADC
+
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#include "FreeRunningAdc.h"
+
+#include "../SharedMacros.h"
+
+extern FreeRunningAdc gFreeRunningAdc;
+
+FreeRunningAdc::FreeRunningAdc()
+{
+}
+
+uint8_t FreeRunningAdc::AddChannel(uint8_t analogPin)
+{
+  if (mNumChannels >= MaxFreeRunningAdcChannels)
+  {
+    DBG_PRINT_LN("FreeRunningAdc::AddChannel() - Too many channels; analogPin = " + String(analogPin) + ".");
+    return mNumChannels - 1;
+  }
+
+  uint8_t channel = mNumChannels++;
+
+  // AVcc reference, and the pin's ADC input.
+  mMuxValues[channel] = bit(REFS0) | ((analogPin - A0) & 0x07);
+  mSamples[channel] = 0;
+  mSampleCounts[channel] = 0;
+
+  // Disable the pin's digital input buffer, which is not needed and adds noise.
+  DIDR0 |= bit(analogPin - A0);
+
+  return channel;
+}
+
+void FreeRunningAdc::Start()
+{
+  if (mNumChannels == 0)
+  {
+    return;
+  }
+
+  mCompletingChannel = 0;
+  mStartedChannel = 0;
+  ADMUX = mMuxValues[0];
+
+  // Free-running trigger source.
+  ADCSRB = 0;
+
+  // Enable the ADC and its interrupt, with auto trigger, and prescaler 128 (125 kHz ADC clock; about 9600 conversions per second).
+  ADCSRA = bit(ADEN) | bit(ADSC) | bit(ADATE) | bit(ADIE) | bit(ADPS2) | bit(ADPS1) | bit(ADPS0);
+}
+
+uint16_t FreeRunningAdc::GetSample(uint8_t channel) const
+{
+  uint16_t sample;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    sample = mSamples[channel];
+  }
+
+  return sample;
+}
+
+// This method is called with interrupts disabled.
+// In free-running mode, the next conversion has already started when this ISR runs, so a new input selection applies to the conversion after it.
+void FreeRunningAdc::OnConversionComplete()
+{
+  uint8_t channel = mCompletingChannel;
+  mSamples[channel] = ADC;
+  mSampleCounts[channel]++;
+
+  mCompletingChannel = mStartedChannel;
+
+  if (mNumChannels > 1)
+  {
+    uint8_t nextChannel = mStartedChannel + 1;
+    if (nextChannel >= mNumChannels)
+    {
+      nextChannel = 0;
+    }
+
+    ADMUX = mMuxValues[nextChannel];
+    mStartedChannel = nextChannel;
+  }
+}
+
+ISR(ADC_vect)
+{
+  gFreeRunningAdc.OnConversionComplete();
+}
+
+#endif // USE_FREE_RUNNING_ADC
@@ -0,0 +1,73 @@
+/*******************************************************************************
+  FreeRunningAdc.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef FreeRunningAdc_H
+#define FreeRunningAdc_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+
+// The maximum number of analog pins sampled by FreeRunningAdc.
+const uint8_t MaxFreeRunningAdcChannels = 2;
+
+// This class runs the ADC in free-running mode, and stores the latest sample of each added analog pin from the ADC ISR.
+// loop() only reads the stored samples; it never waits for a conversion, as analogRead() does.
+// With more than one pin, the ISR selects the pins in turn, so each pin is sampled at the conversion rate divided by the number of pins.
+class FreeRunningAdc {
+
+public:
+  // This method is the default constructor.
+  FreeRunningAdc();
+
+  // This method adds an analog pin (A0..A5), and returns its channel index. It must be called before Start().
+  uint8_t AddChannel(uint8_t analogPin);
+
+  // This method starts the free-running conversions.
+  void Start();
+
+  // This method returns the latest 10-bit sample of the channel.
+  uint16_t GetSample(uint8_t channel) const;
+
+  // This method returns the number of samples taken of the channel, modulo 256. It changes when a new sample is stored.
+  uint8_t GetSampleCount(uint8_t channel) const { return mSampleCounts[channel]; }
+
+  // This method is called by the ADC ISR.
+  void OnConversionComplete();
+
+private:
+  uint8_t mMuxValues[MaxFreeRunningAdcChannels];
+  uint8_t mNumChannels = 0;
+
+  // The channel of the conversion that completes next, and of the conversion after it, which has already started.
+  volatile uint8_t mCompletingChannel = 0;
+  volatile uint8_t mStartedChannel = 0;
+
+  volatile uint16_t mSamples[MaxFreeRunningAdcChannels];
+  volatile uint8_t mSampleCounts[MaxFreeRunningAdcChannels];
+};
+
+#endif
@@ -0,0 +1,103 @@
+/*******************************************************************************
+  PedalEdgeCapture.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless capturing pedal edges.
+#ifdef CAPTURE_PEDAL_EDGES
+
+#include <Arduino.h>
+#include <avr/interrupt.h>
+
+#include "PedalEdgeCapture.h"
+
+#include "../SharedMacros.h"
+
+PedalEdgeCapture* PedalEdgeCapture::sPedalEdgeCapture = NULL;
+
+PedalEdgeCapture::PedalEdgeCapture()
+{
+}
+
+void PedalEdgeCapture::Setup(const PedalPortScanner& pedalPortScanner, const Button* buttons, int numButtons)
+{
+  mPedalPortScanner = &pedalPortScanner;
+  mLastPressedFlags = pedalPortScanner.ReadPressedFlags();
+  sPedalEdgeCapture = this;
+
+  for (int i = 0; i < numButtons; i++)
+  {
+    uint8_t pin = buttons[i].buttonState.pin;
+
+    *digitalPinToPCMSK(pin) |= bit(digitalPinToPCMSKbit(pin));
+    *digitalPinToPCICR(pin) |= bit(digitalPinToPCICRbit(pin));
+  }
+}
+
+void PedalEdgeCapture::OnPinChange()
+{
+  if (sPedalEdgeCapture != NULL)
+  {
+    sPedalEdgeCapture->CapturePedalEvent();
+  }
+}
+
+// This method is called with interrupts disabled.
+void PedalEdgeCapture::CapturePedalEvent()
+{
+  PedalEvent pedalEvent;
+  pedalEvent.timestampMicroseconds = micros();
+  pedalEvent.pressedFlags = mPedalPortScanner->ReadPressedFlags();
+
+  if (pedalEvent.pressedFlags == mLastPressedFlags)
+  {
+    // A non-pedal pin on the same port changed, or the pedal bounced back before the snapshot.
+    return;
+  }
+
+  if (mPedalEvents.Push(pedalEvent))
+  {
+    mLastPressedFlags = pedalEvent.pressedFlags;
+  }
+}
+
+// The pedal pins are on all three ports; every port's pin change interrupt captures a pedal event.
+ISR(PCINT0_vect)
+{
+  PedalEdgeCapture::OnPinChange();
+}
+
+ISR(PCINT1_vect)
+{
+  PedalEdgeCapture::OnPinChange();
+}
+
+ISR(PCINT2_vect)
+{
+  PedalEdgeCapture::OnPinChange();
+}
+
+#endif // CAPTURE_PEDAL_EDGES
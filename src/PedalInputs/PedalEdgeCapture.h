@@ -0,0 +1,75 @@
+/*******************************************************************************
+  PedalEdgeCapture.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalEdgeCapture_H
+#define PedalEdgeCapture_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../Button.h"
+#include "../Utilities/EventRing.h"
+#include "PedalEvent.h"
+#include "PedalPortScanner.h"
+
+// The number of pedal events buffered between pin change interrupts and loop(). Must be a power of two.
+const uint8_t NumPedalEdgeCaptureEvents = 16;
+
+// This class captures pedal edges with pin change interrupts on the pedal pins.
+// Each interrupt takes a port snapshot, and, if any pedal changed, pushes the pressed flags and a microsecond timestamp into an event ring.
+// loop() drains the ring in order; therefore, pedal events are ordered by when they occurred, not by scan index,
+// and are not missed or delayed while loop() is blocked.
+class PedalEdgeCapture {
+
+public:
+  // This method is the default constructor.
+  PedalEdgeCapture();
+
+  // This method enables the pin change interrupts of the buttons passed in.
+  void Setup(const PedalPortScanner& pedalPortScanner, const Button* buttons, int numButtons);
+
+  // This method removes the oldest pedal event. It returns false if there are no pedal events.
+  bool PopEvent(PedalEvent& pedalEvent) { return mPedalEvents.Pop(pedalEvent); }
+
+  // This method returns the number of pedal events dropped because loop() did not drain the ring in time.
+  uint16_t GetNumOverflows() const { return mPedalEvents.GetNumOverflows(); }
+
+  // This method is called by the pin change ISRs.
+  static void OnPinChange();
+
+private:
+  void CapturePedalEvent();
+
+private:
+  // The instance serviced by the pin change ISRs.
+  static PedalEdgeCapture* sPedalEdgeCapture;
+
+  const PedalPortScanner* mPedalPortScanner = NULL;
+  PedalFlags mLastPressedFlags = 0;
+  EventRing<PedalEvent, NumPedalEdgeCaptureEvents> mPedalEvents;
+};
+
+#endif
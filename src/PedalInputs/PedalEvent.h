@@ -1,5 +1,5 @@
 /*******************************************************************************
-  ButtonChangedHandlerBase.cpp
+  PedalEvent.h
   
   MIDI Accompaniment Controller
   https://github.com/BarryKVibes/MidiAccompanimentController
@@ -24,17 +24,18 @@
   
  ******************************************************************************/
 
-#include "../lib/ArduMidi/ardumidi.h"
+#ifndef PedalEvent_H
+#define PedalEvent_H
 
-#include "ButtonChangedHandlerBase.h"
+#include <Arduino.h>
 
-#include "../SharedMacros.h"
+#include "../PedalFlags.h"
 
-// This class provides an interface for Button Changed Handlers.
-ButtonChangedHandlerBase::ButtonChangedHandlerBase()
+// The PedalEvent structure contains a snapshot of the pressed flags of all pedals, and the time it was taken.
+typedef struct
 {
-}
+  PedalFlags pressedFlags;
+  uint32_t timestampMicroseconds;
+} PedalEvent;
 
-void ButtonChangedHandlerBase::HandleButtonChange(Button* button, byte buttonIndex)
-{
-}
\ No newline at end of file
+#endif
@@ -0,0 +1,164 @@
+/*******************************************************************************
+  PedalPinMap.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalPinMap_H
+#define PedalPinMap_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../PedalFlags.h"
+#include "../SharedConstants.h"
+
+// This file contains the compile-time pedal pin map, used by StaticButtonsManager.
+// All port and bit mask lookups are constant expressions for the Arduino Uno (ATmega328P) pin layout:
+// pins 0..7 are PORTD bits 0..7, pins 8..13 are PORTB bits 0..5, and pins A0..A5 (14..19) are PORTC bits 0..5.
+
+namespace PedalPinMapDetail
+{
+  enum Port
+  {
+    PortB,
+    PortC,
+    PortD
+  };
+
+  constexpr Port GetPinPort(uint8_t pin)
+  {
+    return pin < 8 ? Port::PortD : (pin < 14 ? Port::PortB : Port::PortC);
+  }
+
+  constexpr uint8_t GetPinBitMask(uint8_t pin)
+  {
+    return (uint8_t)(1 << (pin < 8 ? pin : (pin < 14 ? pin - 8 : pin - 14)));
+  }
+
+  // Pins 0 and 1 are the MIDI serial port, and the LED is on LedPin.
+  constexpr bool IsValidPedalPin(uint8_t pin)
+  {
+    return pin >= 2 && pin <= 19 && pin != LedPin;
+  }
+
+  // The PinListContains structure determines whether Pin is in the Pins list.
+  template <uint8_t Pin, uint8_t... Pins>
+  struct PinListContains
+  {
+    static constexpr bool Value = false;
+  };
+
+  template <uint8_t Pin, uint8_t FirstPin, uint8_t... Pins>
+  struct PinListContains<Pin, FirstPin, Pins...>
+  {
+    static constexpr bool Value = Pin == FirstPin || PinListContains<Pin, Pins...>::Value;
+  };
+
+  // The PinList structure validates the pin list, and gathers the pressed flags of its pins from a port snapshot.
+  // FirstIndex is the button index of the first pin in the list.
+  template <uint8_t FirstIndex, uint8_t... Pins>
+  struct PinList
+  {
+    static constexpr bool AreValid = true;
+    static constexpr bool AreUnique = true;
+
+    static inline PedalFlags GetPressedFlags(uint8_t, uint8_t, uint8_t) __attribute__((always_inline))
+    {
+      return 0;
+    }
+  };
+
+  template <uint8_t FirstIndex, uint8_t Pin, uint8_t... Pins>
+  struct PinList<FirstIndex, Pin, Pins...>
+  {
+    static constexpr bool AreValid = IsValidPedalPin(Pin) && PinList<FirstIndex + 1, Pins...>::AreValid;
+    static constexpr bool AreUnique = !PinListContains<Pin, Pins...>::Value && PinList<FirstIndex + 1, Pins...>::AreUnique;
+
+    // Each pin compiles to a bit test of a constant port bit; the recursion is fully unrolled.
+    static inline PedalFlags GetPressedFlags(uint8_t pinB, uint8_t pinC, uint8_t pinD) __attribute__((always_inline))
+    {
+      const uint8_t portValue = GetPinPort(Pin) == Port::PortB ? pinB : (GetPinPort(Pin) == Port::PortC ? pinC : pinD);
+
+      // Note: Input pin is pulled high; therefore logic is inverted.
+      return ((portValue & GetPinBitMask(Pin)) == 0 ? (PedalFlags)((PedalFlags)1 << FirstIndex) : (PedalFlags)0)
+        | PinList<FirstIndex + 1, Pins...>::GetPressedFlags(pinB, pinC, pinD);
+    }
+  };
+}
+
+// The PedalPinMap structure is a compile-time list of pedal pins, in button index order.
+// Duplicate pins, and pins that cannot be pedal inputs, are rejected at compile time.
+template <uint8_t... Pins>
+struct PedalPinMap
+{
+  static constexpr uint8_t NumPedals = sizeof...(Pins);
+
+  static_assert(NumPedals <= sizeof(PedalFlags) * 8, "PedalPinMap has more pins than PedalFlags has bits.");
+  static_assert(PedalPinMapDetail::PinList<0, Pins...>::AreValid, "PedalPinMap contains a pin that cannot be a pedal input.");
+  static_assert(PedalPinMapDetail::PinList<0, Pins...>::AreUnique, "PedalPinMap contains a duplicate pin.");
+
+  // This method returns the pressed flags of all pedals, read from one snapshot of the input ports.
+  static inline PedalFlags ReadPressedFlags() __attribute__((always_inline))
+  {
+    uint8_t pinB = PINB;
+    uint8_t pinC = PINC;
+    uint8_t pinD = PIND;
+
+    return PedalPinMapDetail::PinList<0, Pins...>::GetPressedFlags(pinB, pinC, pinD);
+  }
+};
+
+namespace PedalPinMapDetail
+{
+  // The ButtonIndexList structure is a compile-time list of button indexes; MakeButtonIndexList<N>::Type lists 0..N-1.
+  template <uint8_t... ButtonIndexes>
+  struct ButtonIndexList
+  {
+  };
+
+  template <uint8_t NumButtons, uint8_t... ButtonIndexes>
+  struct MakeButtonIndexList : MakeButtonIndexList<NumButtons - 1, NumButtons - 1, ButtonIndexes...>
+  {
+  };
+
+  template <uint8_t... ButtonIndexes>
+  struct MakeButtonIndexList<0, ButtonIndexes...>
+  {
+    typedef ButtonIndexList<ButtonIndexes...> Type;
+  };
+
+  template <class TButtonIndexList>
+  struct BoardPedalPinMapOf;
+
+  template <uint8_t... ButtonIndexes>
+  struct BoardPedalPinMapOf<ButtonIndexList<ButtonIndexes...>>
+  {
+    typedef PedalPinMap<GetBoardPedalPin(ButtonIndexes)...> Type;
+  };
+}
+
+// The BoardPedalPinMap type is the pedal pin map of the pedal boards in PedalBoards.h, in button index order.
+typedef PedalPinMapDetail::BoardPedalPinMapOf<PedalPinMapDetail::MakeButtonIndexList<NumBoardPedals>::Type>::Type BoardPedalPinMap;
+
+#endif
@@ -0,0 +1,91 @@
+/*******************************************************************************
+  PedalPortScanner.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include <Arduino.h>
+
+#include "PedalPortScanner.h"
+
+#include "../SharedMacros.h"
+
+PedalPortScanner::PedalPortScanner()
+{
+}
+
+void PedalPortScanner::Setup(const Button* buttons, int numButtons)
+{
+  mNumButtons = numButtons;
+
+  for (uint8_t i = 0; i < mNumButtons; i++)
+  {
+    uint8_t pin = buttons[i].buttonState.pin;
+
+    // The Uno pins are on ports B, C and D only.
+    switch (digitalPinToPort(pin))
+    {
+      case PB:
+        mPortBits[i].port = Port::PortB;
+        break;
+
+      case PC:
+        mPortBits[i].port = Port::PortC;
+        break;
+
+      default:
+        mPortBits[i].port = Port::PortD;
+        break;
+    }
+
+    mPortBits[i].bitMask = digitalPinToBitMask(pin);
+  }
+}
+
+PedalFlags PedalPortScanner::ReadPressedFlags() const
+{
+  // Take one snapshot of all input ports, so all pedals are sampled at the same time.
+  uint8_t portSnapshot[Port::NumPorts];
+  portSnapshot[Port::PortB] = PINB;
+  portSnapshot[Port::PortC] = PINC;
+  portSnapshot[Port::PortD] = PIND;
+
+  return GetPressedFlags(portSnapshot);
+}
+
+PedalFlags PedalPortScanner::GetPressedFlags(const uint8_t* portSnapshot) const
+{
+  PedalFlags pressedFlags = 0;
+  PedalFlags buttonFlag = 1;
+
+  for (uint8_t i = 0; i < mNumButtons; i++, buttonFlag <<= 1)
+  {
+    // Note: Input pin is pulled high; therefore logic is inverted.
+    if ((portSnapshot[mPortBits[i].port] & mPortBits[i].bitMask) == 0)
+    {
+      pressedFlags |= buttonFlag;
+    }
+  }
+
+  return pressedFlags;
+}
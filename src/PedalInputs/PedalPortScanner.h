@@ -0,0 +1,78 @@
+/*******************************************************************************
+  PedalPortScanner.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalPortScanner_H
+#define PedalPortScanner_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../Button.h"
+#include "../PedalFlags.h"
+#include "../SharedConstants.h"
+
+// This class reads all foot pedal buttons with one read of each AVR input port (PINB, PINC, PIND),
+// instead of calling digitalRead() once per pedal.
+// The pin-to-port lookups are done once, in Setup(), and the results are cached per button.
+class PedalPortScanner {
+
+public:
+  // The Port enum contains the indexes of the port snapshot taken on every scan.
+  enum Port
+  {
+    PortB = 0,
+    PortC = 1,
+    PortD = 2,
+    NumPorts = 3
+  };
+
+private:
+  // The PortBit structure locates a button's input pin within the port snapshot.
+  typedef struct
+  {
+    uint8_t port;
+    uint8_t bitMask;
+  } PortBit;
+
+public:
+  // This method is the default constructor.
+  PedalPortScanner();
+
+  // This method caches the port and bit mask of each button's pin.
+  void Setup(const Button* buttons, int numButtons);
+
+  // This method returns the pressed flags of all buttons, read from one snapshot of the input ports.
+  PedalFlags ReadPressedFlags() const;
+
+  // This method returns the pressed flags of all buttons, given a port snapshot indexed by the Port enum.
+  PedalFlags GetPressedFlags(const uint8_t* portSnapshot) const;
+
+private:
+  PortBit mPortBits[NumFootPedalButtons];
+  uint8_t mNumButtons = 0;
+};
+
+#endif
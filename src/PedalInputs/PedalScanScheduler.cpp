@@ -0,0 +1,187 @@
+/*******************************************************************************
+  PedalScanScheduler.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless scheduling pedal scans.
+#ifdef SCHEDULE_PEDAL_SCANS
+
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#include "PedalScanScheduler.h"
+
+#include "../SharedMacros.h"
+
+// Timer2 runs at F_CPU / 64, and is cleared on compare match with OCR2A.
+const unsigned long ScanTimerTicksPerScan = (F_CPU / 64) * PedalScanPeriodUs / 1000000UL;
+static_assert(ScanTimerTicksPerScan >= 1 && ScanTimerTicksPerScan <= 256, "PedalScanPeriodUs does not fit Timer2 with a prescaler of 64.");
+
+PedalScanScheduler* PedalScanScheduler::sPedalScanScheduler = NULL;
+
+PedalScanScheduler::PedalScanScheduler()
+{
+  ResetScanJitter();
+}
+
+void PedalScanScheduler::Setup(const PedalPortScanner& pedalPortScanner)
+{
+  mPedalPortScanner = &pedalPortScanner;
+  mLastPressedFlags = pedalPortScanner.ReadPressedFlags();
+  sPedalScanScheduler = this;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    // CTC mode, prescaler 64, interrupt on compare match A.
+    TCCR2A = bit(WGM21);
+    TCCR2B = bit(CS22);
+    OCR2A = ScanTimerTicksPerScan - 1;
+    TCNT2 = 0;
+    TIMSK2 = bit(OCIE2A);
+  }
+}
+
+void PedalScanScheduler::OnScanTimer()
+{
+  if (sPedalScanScheduler != NULL)
+  {
+    sPedalScanScheduler->Scan();
+  }
+}
+
+// This method is called with interrupts disabled.
+void PedalScanScheduler::Scan()
+{
+  PedalEvent pedalEvent;
+  pedalEvent.timestampMicroseconds = micros();
+  pedalEvent.pressedFlags = mPedalPortScanner->ReadPressedFlags();
+
+  UpdateScanJitter(pedalEvent.timestampMicroseconds);
+
+  if (pedalEvent.pressedFlags == mLastPressedFlags)
+  {
+    return;
+  }
+
+  if (mPedalEvents.Push(pedalEvent))
+  {
+    mLastPressedFlags = pedalEvent.pressedFlags;
+  }
+}
+
+// This method is called with interrupts disabled.
+void PedalScanScheduler::UpdateScanJitter(unsigned long curTimeUs)
+{
+  unsigned long lastScanTimeUs = mLastScanTimeUs;
+  mLastScanTimeUs = curTimeUs;
+
+  if (lastScanTimeUs == 0)
+  {
+    // There is no previous scan to measure the period from.
+    return;
+  }
+
+  unsigned long periodUs = curTimeUs - lastScanTimeUs;
+  uint16_t clampedPeriodUs = periodUs > 0xFFFF ? 0xFFFF : periodUs;
+
+  if (clampedPeriodUs < mScanJitterStats.minPeriodUs)
+  {
+    mScanJitterStats.minPeriodUs = clampedPeriodUs;
+  }
+
+  if (clampedPeriodUs > mScanJitterStats.maxPeriodUs)
+  {
+    mScanJitterStats.maxPeriodUs = clampedPeriodUs;
+  }
+
+  uint16_t jitterUs = clampedPeriodUs > PedalScanPeriodUs ? clampedPeriodUs - PedalScanPeriodUs : PedalScanPeriodUs - clampedPeriodUs;
+  uint16_t bucket = jitterUs / ScanJitterBucketUs;
+  if (bucket >= NumScanJitterBuckets)
+  {
+    bucket = NumScanJitterBuckets - 1;
+  }
+
+  if (mScanJitterStats.numPeriodsPerBucket[bucket] < 0xFFFF)
+  {
+    mScanJitterStats.numPeriodsPerBucket[bucket]++;
+  }
+
+  if (mNumScans < 0xFFFF)
+  {
+    mNumScans++;
+  }
+}
+
+void PedalScanScheduler::ResetScanJitter()
+{
+  mScanJitterStats.minPeriodUs = 0xFFFF;
+  mScanJitterStats.maxPeriodUs = 0;
+  for (uint8_t i = 0; i < NumScanJitterBuckets; i++)
+  {
+    mScanJitterStats.numPeriodsPerBucket[i] = 0;
+  }
+
+  mNumScans = 0;
+}
+
+void PedalScanScheduler::GetScanJitterStats(ScanJitterStats& scanJitterStats) const
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    scanJitterStats = mScanJitterStats;
+  }
+}
+
+void PedalScanScheduler::ReportScanJitter()
+{
+  ScanJitterStats scanJitterStats;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    if (mNumScans < NumScansPerJitterReport)
+    {
+      return;
+    }
+
+    scanJitterStats = mScanJitterStats;
+    ResetScanJitter();
+  }
+
+  DBG_PRINT("PedalScanScheduler::ReportScanJitter() - Period us min = " + String(scanJitterStats.minPeriodUs) + "; max = " + String(scanJitterStats.maxPeriodUs) + "; histogram =");
+  for (uint8_t i = 0; i < NumScanJitterBuckets; i++)
+  {
+    DBG_PRINT(" " + String(scanJitterStats.numPeriodsPerBucket[i]));
+  }
+
+  DBG_PRINT_LN("");
+}
+
+ISR(TIMER2_COMPA_vect)
+{
+  PedalScanScheduler::OnScanTimer();
+}
+
+#endif // SCHEDULE_PEDAL_SCANS
@@ -0,0 +1,104 @@
+/*******************************************************************************
+  PedalScanScheduler.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalScanScheduler_H
+#define PedalScanScheduler_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../SharedConstants.h"
+#include "../Utilities/EventRing.h"
+#include "PedalEvent.h"
+#include "PedalPortScanner.h"
+
+// The number of pedal events buffered between the scan timer ISR and loop(). Must be a power of two.
+const uint8_t NumPedalScanEvents = 16;
+
+// The scan period jitter histogram has NumScanJitterBuckets buckets, each ScanJitterBucketUs wide.
+// Bucket N counts the scan periods that differ from PedalScanPeriodUs by N * ScanJitterBucketUs or more; the last bucket counts the rest.
+const uint8_t NumScanJitterBuckets = 8;
+const uint8_t ScanJitterBucketUs = 4;
+
+// The number of scans between scan jitter reports.
+const uint16_t NumScansPerJitterReport = 10000;
+
+// This struct contains the scan period jitter statistics, in microseconds. The counts saturate at 0xFFFF.
+struct ScanJitterStats
+{
+  uint16_t minPeriodUs;
+  uint16_t maxPeriodUs;
+  uint16_t numPeriodsPerBucket[NumScanJitterBuckets];
+};
+
+// This class scans the pedal ports from a Timer2 compare match ISR, every PedalScanPeriodUs.
+// If any pedal changed, the ISR pushes the pressed flags and a microsecond timestamp into an event ring, which loop() drains in order.
+// The sampling rate therefore does not depend on how long loop() takes; for example, while a SysEx message is written.
+// The ISR also records the scan period jitter, as measured with micros(), whose resolution is 4 us.
+class PedalScanScheduler {
+
+public:
+  // This method is the default constructor.
+  PedalScanScheduler();
+
+  // This method starts the scan timer. Timer2 is used; therefore, tone() cannot be used.
+  void Setup(const PedalPortScanner& pedalPortScanner);
+
+  // This method removes the oldest pedal event. It returns false if there are no pedal events.
+  bool PopEvent(PedalEvent& pedalEvent) { return mPedalEvents.Pop(pedalEvent); }
+
+  // This method returns the number of pedal events dropped because loop() did not drain the ring in time.
+  uint16_t GetNumOverflows() const { return mPedalEvents.GetNumOverflows(); }
+
+  // This method copies the scan period jitter statistics.
+  void GetScanJitterStats(ScanJitterStats& scanJitterStats) const;
+
+  // This method reports the scan period jitter statistics every NumScansPerJitterReport scans, and resets them.
+  void ReportScanJitter();
+
+  // This method is called by the scan timer ISR.
+  static void OnScanTimer();
+
+private:
+  void Scan();
+  void UpdateScanJitter(unsigned long curTimeUs);
+  void ResetScanJitter();
+
+private:
+  // The instance serviced by the scan timer ISR.
+  static PedalScanScheduler* sPedalScanScheduler;
+
+  const PedalPortScanner* mPedalPortScanner = NULL;
+  PedalFlags mLastPressedFlags = 0;
+  EventRing<PedalEvent, NumPedalScanEvents> mPedalEvents;
+
+  // The scan jitter statistics are written by the ISR.
+  unsigned long mLastScanTimeUs = 0;
+  volatile uint16_t mNumScans = 0;
+  ScanJitterStats mScanJitterStats;
+};
+
+#endif
@@ -0,0 +1,98 @@
+/*******************************************************************************
+  ResistorLadderPedalInput.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless reading ladder pedals.
+#ifdef READ_LADDER_PEDALS
+
+#include <Arduino.h>
+
+#include "ResistorLadderPedalInput.h"
+
+#include "../SharedMacros.h"
+
+// The ADC counts between adjacent ladder levels.
+static const uint16_t LadderStep = 1024 >> NumLadderPedals;
+static const uint8_t MaxLadderFlags = (1 << NumLadderPedals) - 1;
+
+ResistorLadderPedalInput::ResistorLadderPedalInput()
+{
+}
+
+void ResistorLadderPedalInput::Setup(FreeRunningAdc& freeRunningAdc)
+{
+  mFreeRunningAdc = &freeRunningAdc;
+  mAdcChannel = freeRunningAdc.AddChannel(LadderPedalPin);
+  mLastSampleCount = freeRunningAdc.GetSampleCount(mAdcChannel);
+}
+
+PedalFlags ResistorLadderPedalInput::ReadPressedFlags()
+{
+  uint8_t sampleCount = mFreeRunningAdc->GetSampleCount(mAdcChannel);
+  if (sampleCount != mLastSampleCount)
+  {
+    mLastSampleCount = sampleCount;
+    ClassifySample(mFreeRunningAdc->GetSample(mAdcChannel));
+  }
+
+  return mPressedFlags;
+}
+
+uint8_t ResistorLadderPedalInput::ClassifySample(uint16_t sample)
+{
+  // Stay at the current level while the sample is within its band, widened by the hysteresis.
+  uint16_t curLevel = mPressedFlags * LadderStep;
+  uint16_t distance = sample > curLevel ? sample - curLevel : curLevel - sample;
+  if (distance <= LadderStep / 2 + LadderHysteresis)
+  {
+    mNumCandidateSamples = 0;
+    return mPressedFlags;
+  }
+
+  // Round to the nearest level.
+  uint16_t nearestFlags = (sample + LadderStep / 2) / LadderStep;
+  if (nearestFlags > MaxLadderFlags)
+  {
+    nearestFlags = MaxLadderFlags;
+  }
+
+  if (nearestFlags != mCandidateFlags || mNumCandidateSamples == 0)
+  {
+    mCandidateFlags = nearestFlags;
+    mNumCandidateSamples = 0;
+  }
+
+  if (++mNumCandidateSamples >= LadderStableSamples)
+  {
+    mPressedFlags = mCandidateFlags;
+    mNumCandidateSamples = 0;
+  }
+
+  return mPressedFlags;
+}
+
+#endif // READ_LADDER_PEDALS
@@ -0,0 +1,68 @@
+/*******************************************************************************
+  ResistorLadderPedalInput.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef ResistorLadderPedalInput_H
+#define ResistorLadderPedalInput_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../PedalFlags.h"
+#include "../SharedConstants.h"
+#include "FreeRunningAdc.h"
+
+// This class reads a board of NumLadderPedals pedals through one analog pin, wired as an R-2R resistor ladder.
+// Each pedal is a SPDT footswitch that connects its ladder input to 5 V when pressed, and to ground when released,
+// so the ladder voltage is proportional to the pressed flags: sample = pressedFlags * LadderStep.
+// The samples are taken by FreeRunningAdc; classifying a sample takes a few arithmetic operations, and never waits for the ADC.
+class ResistorLadderPedalInput {
+
+public:
+  // This method is the default constructor.
+  ResistorLadderPedalInput();
+
+  // This method adds the ladder pin to the free-running ADC.
+  void Setup(FreeRunningAdc& freeRunningAdc);
+
+  // This method returns the pressed flags of the ladder pedals, starting at bit 0.
+  PedalFlags ReadPressedFlags();
+
+  // This method classifies one ladder sample, and returns the pressed flags of the ladder pedals.
+  // A sample must leave the current level's band by LadderHysteresis, and the new level must be seen in LadderStableSamples
+  // consecutive samples, before the pressed flags change. This rejects noise, and the levels passed through while switches move.
+  uint8_t ClassifySample(uint16_t sample);
+
+private:
+  FreeRunningAdc* mFreeRunningAdc = NULL;
+  uint8_t mAdcChannel = 0;
+  uint8_t mLastSampleCount = 0;
+
+  uint8_t mPressedFlags = 0;
+  uint8_t mCandidateFlags = 0;
+  uint8_t mNumCandidateSamples = 0;
+};
+
+#endif
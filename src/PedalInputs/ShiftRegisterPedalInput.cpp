@@ -0,0 +1,88 @@
+/*******************************************************************************
+  ShiftRegisterPedalInput.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless reading pedals from shift registers.
+#ifdef READ_PEDALS_FROM_SHIFT_REGISTERS
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "ShiftRegisterPedalInput.h"
+
+#include "../SharedMacros.h"
+
+// The 74HC165 shifts on the rising clock edge; SPI mode 0 samples each bit on that same edge, before it changes.
+static const SPISettings PedalShiftRegisterSpiSettings(PedalShiftRegisterClockHz, MSBFIRST, SPI_MODE0);
+
+ShiftRegisterPedalInput::ShiftRegisterPedalInput()
+{
+}
+
+void ShiftRegisterPedalInput::Setup()
+{
+  pinMode(PedalShiftRegisterLoadPin, OUTPUT);
+  digitalWrite(PedalShiftRegisterLoadPin, HIGH);
+
+  SPI.begin();
+}
+
+PedalFlags ShiftRegisterPedalInput::ReadPressedFlags()
+{
+  uint8_t registerBytes[NumPedalShiftRegisters];
+
+  SPI.beginTransaction(PedalShiftRegisterSpiSettings);
+
+  // Latch all pedal inputs into the shift registers.
+  digitalWrite(PedalShiftRegisterLoadPin, LOW);
+  digitalWrite(PedalShiftRegisterLoadPin, HIGH);
+
+  for (uint8_t i = 0; i < NumPedalShiftRegisters; i++)
+  {
+    registerBytes[i] = SPI.transfer(0);
+  }
+
+  SPI.endTransaction();
+
+  return GetPressedFlags(registerBytes);
+}
+
+PedalFlags ShiftRegisterPedalInput::GetPressedFlags(const uint8_t* registerBytes)
+{
+  PedalFlags pressedFlags = 0;
+
+  // Register 0 holds the lowest pedal numbers. The bytes are MSB first, so D7 is the byte's high bit.
+  for (int8_t i = NumPedalShiftRegisters - 1; i >= 0; i--)
+  {
+    // Note: Inputs are pulled high; therefore logic is inverted.
+    pressedFlags = (pressedFlags << 8) | (uint8_t)~registerBytes[i];
+  }
+
+  return pressedFlags;
+}
+
+#endif // READ_PEDALS_FROM_SHIFT_REGISTERS
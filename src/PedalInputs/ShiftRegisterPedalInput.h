@@ -0,0 +1,59 @@
+/*******************************************************************************
+  ShiftRegisterPedalInput.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef ShiftRegisterPedalInput_H
+#define ShiftRegisterPedalInput_H
+
+#include <Arduino.h>
+
+#include "../MidiAccompanimentController.h"
+#include "../PedalFlags.h"
+#include "../SharedConstants.h"
+
+// This class reads the foot pedals from a chain of NumPedalShiftRegisters 74HC165 parallel-in/serial-out shift registers.
+// All pedals are latched at once by pulsing SH/LD low, then clocked in over hardware SPI, one byte per register.
+// The scan time is one load pulse plus one SPI byte transfer per eight pedals.
+//
+// Wiring: SH/LD to PedalShiftRegisterLoadPin, CLK to SCK (pin 13), CLK INH to ground, and the first register's QH to MISO (pin 12).
+// Each register's SER input is the next register's QH. Pedal inputs are pulled up, and a pressed pedal connects its input to ground.
+// Pedal N is input D(N % 8) of register N / 8, where register 0 is the one connected to MISO.
+class ShiftRegisterPedalInput {
+
+public:
+  // This method is the default constructor.
+  ShiftRegisterPedalInput();
+
+  // This method configures the load pin and SPI.
+  void Setup();
+
+  // This method returns the pressed flags of all pedals.
+  PedalFlags ReadPressedFlags();
+
+  // This method returns the pressed flags of all pedals, given the bytes clocked in from the shift registers, starting with register 0.
+  static PedalFlags GetPressedFlags(const uint8_t* registerBytes);
+};
+
+#endif
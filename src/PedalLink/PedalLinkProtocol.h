@@ -0,0 +1,64 @@
+/*******************************************************************************
+  PedalLinkProtocol.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalLinkProtocol_H
+#define PedalLinkProtocol_H
+
+#include <Arduino.h>
+
+#include <util/crc16.h>
+
+#include "../SharedConstants.h"
+
+// The pedal link carries a remote board's pedal bitmap to the main controller, over the remote board's UART TX and the main controller's UART RX.
+// Each frame is a MIDI System Exclusive message, so it can share the UART with MIDI, and every byte after the start byte has its high bit clear:
+// F0 7D 01 ss bb ... bb cc cc F7
+// 7D = non-commercial manufacturer ID; 01 = bitmap frame; ss = sequence number (0..127);
+// bb = NumPedalLinkBitmapBytes bitmap bytes, 7 pedals per byte, least significant first; cc cc = CRC-8 of 01, ss and bb, high nibble first.
+
+const uint8_t PedalLinkStartByte = 0xF0;
+const uint8_t PedalLinkEndByte = 0xF7;
+const uint8_t PedalLinkManufacturerId = 0x7D;
+const uint8_t PedalLinkBitmapFrameType = 0x01;
+
+const uint8_t NumPedalLinkBitmapBytes = (NumLinkedPedals + 6) / 7;
+
+// The frame bytes between the start and end bytes.
+const uint8_t NumPedalLinkFrameBytes = 3 + NumPedalLinkBitmapBytes + 2;
+
+// This function returns the CRC-8 of the bytes passed in.
+inline uint8_t GetPedalLinkCrc(const uint8_t* bytes, uint8_t numBytes)
+{
+  uint8_t crc = 0;
+  for (uint8_t i = 0; i < numBytes; i++)
+  {
+    crc = _crc8_ccitt_update(crc, bytes[i]);
+  }
+
+  return crc;
+}
+
+#endif
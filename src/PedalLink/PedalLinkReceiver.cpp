@@ -0,0 +1,151 @@
+/*******************************************************************************
+  PedalLinkReceiver.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless receiving the pedal link.
+#ifdef RECEIVE_PEDAL_LINK
+
+#include <Arduino.h>
+
+#include "PedalLinkReceiver.h"
+
+#include "../SharedMacros.h"
+
+PedalLinkReceiver::PedalLinkReceiver()
+{
+  for (uint8_t i = 0; i < NumPedalLinkBitmapBytes; i++)
+  {
+    mBitmapBytes[i] = 0;
+  }
+}
+
+bool PedalLinkReceiver::Update()
+{
+  bool isFrameReceived = false;
+
+  while (Serial.available() > 0)
+  {
+    switch (mFrameParser.ParseByte(Serial.read()))
+    {
+      case SysExFrameParser<NumPedalLinkFrameBytes>::FrameRestarted:
+        // The previous frame has no end byte.
+        CountFrameError();
+        mFrameStartTimeUs = micros();
+        break;
+
+      case SysExFrameParser<NumPedalLinkFrameBytes>::FrameStarted:
+        mFrameStartTimeUs = micros();
+        break;
+
+      case SysExFrameParser<NumPedalLinkFrameBytes>::FrameReceived:
+        isFrameReceived |= HandleFrame();
+        break;
+
+      case SysExFrameParser<NumPedalLinkFrameBytes>::FrameAborted:
+        CountFrameError();
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  return isFrameReceived;
+}
+
+bool PedalLinkReceiver::HandleFrame()
+{
+  const uint8_t* frameBytes = mFrameParser.GetFrameBytes();
+  uint8_t numFrameBytes = mFrameParser.GetNumFrameBytes();
+
+  // Ignore System Exclusive messages that are not pedal link frames.
+  if (numFrameBytes < 2 || frameBytes[0] != PedalLinkManufacturerId || frameBytes[1] != PedalLinkBitmapFrameType)
+  {
+    return false;
+  }
+
+  if (mFrameParser.IsFrameOverrun() || numFrameBytes != NumPedalLinkFrameBytes)
+  {
+    CountFrameError();
+    return false;
+  }
+
+  const uint8_t crcIndex = NumPedalLinkFrameBytes - 2;
+  uint8_t crc = GetPedalLinkCrc(&frameBytes[1], crcIndex - 1);
+  if (crc != ((frameBytes[crcIndex] << 4) | frameBytes[crcIndex + 1]))
+  {
+    CountFrameError();
+    return false;
+  }
+
+  uint8_t sequenceNumber = frameBytes[2];
+  if (mIsFrameReceived)
+  {
+    uint8_t numLostFrames = (sequenceNumber - mLastSequenceNumber - 1) & 0x7F;
+    if (numLostFrames != 0)
+    {
+      mNumLostFrames += numLostFrames;
+      DBG_PRINT_LN("PedalLinkReceiver::HandleFrame() - Lost frames = " + String(mNumLostFrames) + ".");
+    }
+  }
+
+  mIsFrameReceived = true;
+  mLastSequenceNumber = sequenceNumber;
+  mLastFrameTimeMs = millis();
+
+  for (uint8_t i = 0; i < NumPedalLinkBitmapBytes; i++)
+  {
+    mBitmapBytes[i] = frameBytes[3 + i];
+  }
+
+  unsigned long latencyUs = micros() - mFrameStartTimeUs;
+  if (latencyUs > mMaxLatencyUs)
+  {
+    mMaxLatencyUs = latencyUs;
+    DBG_PRINT_LN("PedalLinkReceiver::HandleFrame() - Max latency = " + String(mMaxLatencyUs) + " us.");
+  }
+
+  return true;
+}
+
+bool PedalLinkReceiver::IsTimedOut() const
+{
+  // Unsigned subtraction is correct across the millis() rollover.
+  return !mIsFrameReceived || millis() - mLastFrameTimeMs >= PedalLinkTimeoutMs;
+}
+
+void PedalLinkReceiver::CountFrameError()
+{
+  if (mNumFrameErrors < 0xFFFF)
+  {
+    mNumFrameErrors++;
+  }
+
+  DBG_PRINT_LN("PedalLinkReceiver::CountFrameError() - Frame errors = " + String(mNumFrameErrors) + ".");
+}
+
+#endif // RECEIVE_PEDAL_LINK
@@ -0,0 +1,80 @@
+/*******************************************************************************
+  PedalLinkReceiver.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalLinkReceiver_H
+#define PedalLinkReceiver_H
+
+#include <Arduino.h>
+
+#include "PedalLinkProtocol.h"
+#include "../Utilities/SysExFrameParser.h"
+
+// This class runs on the main controller. It parses the pedal link frames from the UART, and keeps the latest remote pedal bitmap bytes.
+// Frames with a bad length or CRC are dropped and counted; sequence number gaps are counted as lost frames.
+// System Exclusive messages for other manufacturers, or other frame types, are ignored.
+class PedalLinkReceiver {
+
+public:
+  // This method is the default constructor.
+  PedalLinkReceiver();
+
+  // This method reads the received bytes. It returns true if a new bitmap frame was received.
+  bool Update();
+
+  // This method returns a bitmap byte of the latest frame; 7 pedals per byte, least significant first.
+  uint8_t GetBitmapByte(uint8_t index) const { return mBitmapBytes[index]; }
+
+  // This method returns true if no frame has been received for PedalLinkTimeoutMs.
+  bool IsTimedOut() const;
+
+  // This method returns the number of frames dropped for a bad length, CRC or byte, and the number of frames lost, per the sequence numbers.
+  uint16_t GetNumFrameErrors() const { return mNumFrameErrors; }
+  uint16_t GetNumLostFrames() const { return mNumLostFrames; }
+
+  // This method returns the largest time from reading a frame's first byte to handling the frame, in microseconds.
+  unsigned long GetMaxLatencyUs() const { return mMaxLatencyUs; }
+
+private:
+  // This method handles a complete frame. It returns true if it is a valid bitmap frame.
+  bool HandleFrame();
+
+  void CountFrameError();
+
+private:
+  SysExFrameParser<NumPedalLinkFrameBytes> mFrameParser;
+  unsigned long mFrameStartTimeUs = 0;
+
+  uint8_t mBitmapBytes[NumPedalLinkBitmapBytes];
+  bool mIsFrameReceived = false;
+  uint8_t mLastSequenceNumber = 0;
+  unsigned long mLastFrameTimeMs = 0;
+
+  uint16_t mNumFrameErrors = 0;
+  uint16_t mNumLostFrames = 0;
+  unsigned long mMaxLatencyUs = 0;
+};
+
+#endif
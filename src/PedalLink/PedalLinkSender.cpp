@@ -0,0 +1,101 @@
+/*******************************************************************************
+  PedalLinkSender.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless sending the pedal link.
+#ifdef SEND_PEDAL_LINK
+
+#include <Arduino.h>
+
+#include "PedalLinkSender.h"
+#include "PedalLinkProtocol.h"
+
+#include "../SharedMacros.h"
+
+static_assert(NumFootPedalButtons <= NumLinkedPedals, "The remote board has more pedals than NumLinkedPedals.");
+
+PedalLinkSender::PedalLinkSender()
+{
+}
+
+void PedalLinkSender::SetPedal(byte buttonIndex, bool isActive)
+{
+  PedalFlags buttonFlag = (PedalFlags)1 << buttonIndex;
+  if (isActive)
+  {
+    mPressedFlags |= buttonFlag;
+  }
+  else
+  {
+    mPressedFlags &= ~buttonFlag;
+  }
+}
+
+void PedalLinkSender::Update()
+{
+  // Unsigned subtraction is correct across the millis() rollover.
+  if (mIsSent && mPressedFlags == mSentPressedFlags && millis() - mLastSendTimeMs < PedalLinkRefreshMs)
+  {
+    return;
+  }
+
+  SendBitmapFrame();
+}
+
+void PedalLinkSender::SendBitmapFrame()
+{
+  uint8_t frame[1 + NumPedalLinkFrameBytes + 1];
+  uint8_t numBytes = 0;
+
+  frame[numBytes++] = PedalLinkStartByte;
+  frame[numBytes++] = PedalLinkManufacturerId;
+
+  uint8_t crcStart = numBytes;
+  frame[numBytes++] = PedalLinkBitmapFrameType;
+  frame[numBytes++] = mSequenceNumber;
+
+  PedalFlags pressedFlags = mPressedFlags;
+  for (uint8_t i = 0; i < NumPedalLinkBitmapBytes; i++)
+  {
+    frame[numBytes++] = pressedFlags & 0x7F;
+    pressedFlags >>= 7;
+  }
+
+  uint8_t crc = GetPedalLinkCrc(&frame[crcStart], numBytes - crcStart);
+  frame[numBytes++] = crc >> 4;
+  frame[numBytes++] = crc & 0x0F;
+  frame[numBytes++] = PedalLinkEndByte;
+
+  Serial.write(frame, numBytes);
+
+  mSentPressedFlags = mPressedFlags;
+  mIsSent = true;
+  mSequenceNumber = (mSequenceNumber + 1) & 0x7F;
+  mLastSendTimeMs = millis();
+}
+
+#endif // SEND_PEDAL_LINK
@@ -0,0 +1,59 @@
+/*******************************************************************************
+  PedalLinkSender.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PedalLinkSender_H
+#define PedalLinkSender_H
+
+#include <Arduino.h>
+
+#include "../PedalFlags.h"
+
+// This class runs on the remote board. It sends the remote board's debounced pedal bitmap to the main controller, when it changes.
+// The bitmap is also sent every PedalLinkRefreshMs without a change, so a lost frame is corrected, and the main controller can tell the link is up.
+class PedalLinkSender {
+
+public:
+  // This method is the default constructor.
+  PedalLinkSender();
+
+  // This method sets a pedal's pressed state.
+  void SetPedal(byte buttonIndex, bool isActive);
+
+  // This method must be called from loop(). It sends the bitmap if it changed, or if it is due to be refreshed.
+  void Update();
+
+private:
+  void SendBitmapFrame();
+
+private:
+  PedalFlags mPressedFlags = 0;
+  PedalFlags mSentPressedFlags = 0;
+  bool mIsSent = false;
+  uint8_t mSequenceNumber = 0;
+  unsigned long mLastSendTimeMs = 0;
+};
+
+#endif
@@ -0,0 +1,158 @@
+/*******************************************************************************
+  PerformanceJournal.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+
+#include "PerformanceJournal.h"
+#include "EepromLayout.h"
+#include "SharedConstants.h"
+#include "SharedMacros.h"
+
+// The latest record is the valid record whose sequence number is the largest; sequence numbers wrap, and the valid records
+// span at most NumPerformanceJournalRecords consecutive numbers, so they are compared by their signed difference.
+bool PerformanceJournal::Setup(PerformanceState& state)
+{
+  static_assert(sizeof(JournalRecord) == EepromPerformanceJournalRecordSize, "The journal record size does not match the EEPROM layout.");
+
+#ifndef SEND_MIDI
+  unsigned long startTimeUs = micros();
+#endif
+
+  bool isFound = false;
+  for (uint8_t slot = 0; slot < NumPerformanceJournalRecords; slot++)
+  {
+    JournalRecord record;
+    eeprom_read_block(&record, (const void*)GetRecordAddress(slot), sizeof(JournalRecord));
+    if (record.crc != GetCrc(record))
+    {
+      continue;
+    }
+
+    if (!isFound || (int8_t)(record.sequenceNumber - mLatestSequenceNumber) > 0)
+    {
+      isFound = true;
+      mLatestSlot = slot;
+      mLatestSequenceNumber = record.sequenceNumber;
+      mRecordedState = record.state;
+    }
+  }
+
+  if (!isFound)
+  {
+    // The first record is then written to slot 0.
+    mLatestSlot = NumPerformanceJournalRecords - 1;
+  }
+
+  mPendingState = mRecordedState;
+  state = mRecordedState;
+
+#ifndef SEND_MIDI
+  // Reading every record takes well under a millisecond; it is measured here to keep it so.
+  unsigned long scanTimeUs = micros() - startTimeUs;
+  DBG_PRINT_LN("PerformanceJournal::Setup() - isFound = " + String(isFound) + "; mLatestSlot = " + String(mLatestSlot) + "; scanTimeUs = " + String(scanTimeUs) + ".");
+#endif
+
+  return isFound;
+}
+
+void PerformanceJournal::Update(const PerformanceState& state)
+{
+  unsigned long curTimeMs = millis();
+
+  if (!IsSamePerformanceState(state, mPendingState))
+  {
+    // Restart the wait on every change, so a run of changes is written once.
+    mPendingState = state;
+    mIsRecordPending = !IsSamePerformanceState(state, mRecordedState);
+    mLastChangeTimeMs = curTimeMs;
+  }
+
+  if (mRecordStep != NoRecordStep)
+  {
+    WriteNextRecordByte();
+    return;
+  }
+
+  // Unsigned subtraction is correct across the millis() rollover.
+  if (mIsRecordPending && curTimeMs - mLastChangeTimeMs >= PerformanceJournalSaveDelayMs)
+  {
+    BeginRecord();
+  }
+}
+
+void PerformanceJournal::BeginRecord()
+{
+  mLatestSlot = (mLatestSlot + 1) % NumPerformanceJournalRecords;
+  mLatestSequenceNumber++;
+
+  mRecord.state = mPendingState;
+  mRecord.sequenceNumber = mLatestSequenceNumber;
+  mRecord.crc = GetCrc(mRecord);
+
+  mRecordedState = mPendingState;
+  mIsRecordPending = false;
+  mRecordStep = 0;
+}
+
+// The CRC is the record's last byte, so it is written last. An EEPROM write takes about 3.3 ms; only one is started per call.
+void PerformanceJournal::WriteNextRecordByte()
+{
+  if (!eeprom_is_ready())
+  {
+    return;
+  }
+
+  EEPROM.update(GetRecordAddress(mLatestSlot) + mRecordStep, ((const uint8_t*)&mRecord)[mRecordStep]);
+
+  mRecordStep++;
+  if (mRecordStep == sizeof(JournalRecord))
+  {
+    mRecordStep = NoRecordStep;
+    DBG_PRINT_LN("PerformanceJournal::WriteNextRecordByte() - Recorded slot " + String(mLatestSlot) + ".");
+  }
+}
+
+// The CRC covers the journal version, so records of another format are not valid.
+uint8_t PerformanceJournal::GetCrc(const JournalRecord& record)
+{
+  uint8_t crc = _crc8_ccitt_update(0, EepromPerformanceJournalVersion);
+
+  const uint8_t* bytes = (const uint8_t*)&record;
+  for (uint8_t i = 0; i < sizeof(JournalRecord) - 1; i++)
+  {
+    crc = _crc8_ccitt_update(crc, bytes[i]);
+  }
+
+  return crc;
+}
+
+int PerformanceJournal::GetRecordAddress(uint8_t slot)
+{
+  return EepromPerformanceJournalAddress + slot * EepromPerformanceJournalRecordSize;
+}
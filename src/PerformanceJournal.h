@@ -0,0 +1,87 @@
+/*******************************************************************************
+  PerformanceJournal.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PerformanceJournal_H
+#define PerformanceJournal_H
+
+#include <Arduino.h>
+
+#include "PerformanceState.h"
+
+// This class keeps the performance state in an append-only journal of NumPerformanceJournalRecords records in EEPROM.
+// Each record is written to the slot after the latest record, so the writes are spread across all the slots' cells.
+// A record is written PerformanceJournalSaveDelayMs after the state last changed, so a run of tempo changes is written once,
+// and one byte is written per Update() call, from loop(); an EEPROM write is never started while a pedal is handled.
+// Each record has a sequence number and a CRC-8; a record left partly written by a reset fails its CRC, and the previous record is used.
+class PerformanceJournal {
+
+public:
+  // This method reads the latest valid record into state. It returns false if there is none.
+  // It reads every record once, so its time is bounded by the journal size. It must be called from setup().
+  bool Setup(PerformanceState& state);
+
+  // This method must be called from loop(), with the current performance state.
+  void Update(const PerformanceState& state);
+
+  // This method returns true if no record is waiting to be written, or being written.
+  bool IsIdle() const { return !mIsRecordPending && mRecordStep == NoRecordStep; }
+
+private:
+  // This struct is a journal record, as stored in EEPROM.
+  struct JournalRecord
+  {
+    PerformanceState state;
+    uint8_t sequenceNumber;
+    uint8_t crc;
+  };
+
+  static uint8_t GetCrc(const JournalRecord& record);
+  static int GetRecordAddress(uint8_t slot);
+
+  // This method starts writing the pending state to the slot after the latest record.
+  void BeginRecord();
+
+  // This method writes the next byte of the record being written.
+  void WriteNextRecordByte();
+
+private:
+  // The state of the latest record, written or being written, and the state waiting to be written.
+  PerformanceState mRecordedState = UnknownPerformanceState;
+  PerformanceState mPendingState = UnknownPerformanceState;
+  bool mIsRecordPending = false;
+  unsigned long mLastChangeTimeMs = 0;
+
+  // The slot and sequence number of the latest record.
+  uint8_t mLatestSlot = 0;
+  uint8_t mLatestSequenceNumber = 0;
+
+  // The record being written, and its next byte, or NoRecordStep if no record is being written.
+  static const uint8_t NoRecordStep = 0xFF;
+  JournalRecord mRecord;
+  uint8_t mRecordStep = NoRecordStep;
+};
+
+#endif
@@ -0,0 +1,54 @@
+/*******************************************************************************
+  PerformanceState.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef PerformanceState_H
+#define PerformanceState_H
+
+#include <Arduino.h>
+
+// This struct is the performance state that is kept across power cycles, by PerformanceJournal.
+// A style number or tempo of 0, or a section of UnknownSectionSwitchNum, is not yet known.
+struct PerformanceState
+{
+  uint16_t styleNum;
+  uint8_t tempo;
+
+  // The StyleSectionControlSwitchNum of the last section switched on.
+  uint8_t sectionSwitchNum;
+};
+
+const uint8_t UnknownSectionSwitchNum = 0xFF;
+
+// The performance state before anything is sent, or recorded.
+const PerformanceState UnknownPerformanceState = {0, 0, UnknownSectionSwitchNum};
+
+// This function returns true if the performance states are the same.
+inline bool IsSamePerformanceState(const PerformanceState& state1, const PerformanceState& state2)
+{
+  return state1.styleNum == state2.styleNum && state1.tempo == state2.tempo && state1.sectionSwitchNum == state2.sectionSwitchNum;
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*******************************************************************************
+  RegistrationBank.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+#ifndef RegistrationBank_H
+#define RegistrationBank_H
+
+#include <Arduino.h>
+
+#include "PedalAction.h"
+
+// The number of registration banks. Bank 0 is the pedal configuration; the others are compiled-in, in flash.
+const uint8_t NumRegistrationBanks = 5;
+
+// The number of pedals a registration bank assigns; the logical pedals of a Style Select board.
+const uint8_t NumRegistrationBankPedals = 8;
+
+// This struct is a registration bank: the press actions of the Style Select boards' pedals, and the default tempo.
+// Selecting a bank copies it into the pedal configuration's RAM image, so a pedal press is still one table lookup.
+struct RegistrationBank
+{
+  PedalActionDescriptor pedalActions[NumRegistrationBankPedals];
+  uint8_t defaultTempo;
+};
+
+#endif
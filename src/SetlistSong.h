@@ -0,0 +1,44 @@
+/*******************************************************************************
+  SetlistSong.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+#ifndef SetlistSong_H
+#define SetlistSong_H
+
+#include <Arduino.h>
+
+// This struct is a packed set list record, stored in flash; 4 bytes per song.
+// Selecting the song sends its style, its tempo, and a press of its starting section, as one burst.
+struct SetlistSong
+{
+  uint16_t styleNum;
+  uint8_t tempo;
+
+  // The StyleSectionControlSwitchNum of the starting section.
+  uint8_t sectionSwitchNum;
+};
+
+#endif
@@ -25,18 +25,19 @@
  ******************************************************************************/
 
 #include "FootPedalSetupManager.h"
+#include "../PedalBoards.h"
 #include "../Utilities/Utilities.h"
 #include "../SharedMacros.h"
 
 // Global Variables
 extern Button gFootPedalButtons[NumFootPedalButtons];
 
-FootPedalSetupManager::FootPedalSetupManager() : SetupManagerBase()
+FootPedalSetupManager::FootPedalSetupManager()
 {
 }
 
 // Initializes serial port for either sending MIDI or writing to the Serial Monitor.
-void FootPedalSetupManager::Setup()
+void FootPedalSetupManager::SetupImpl()
 {
   // Setup LED pin early to allow it to enable flashing error code.
   pinMode(LedPin, OUTPUT);
@@ -48,14 +49,18 @@ void FootPedalSetupManager::Setup()
   Serial.begin(BaudRateSerialMonitor);
 #endif
 
-  int numButtons = GetNumButtons();
-  for (char i = 0; i < numButtons; i++)
+#ifndef READ_PEDALS_FROM_SHIFT_REGISTERS
+  SetupPedalBoardButtons(gFootPedalButtons);
+
+  // Shift register and ladder pedals are not connected to their own pins; their input is set up by ButtonsManager::Setup().
+  for (char i = 0; i < NumDigitalPedals; i++)
   {
     int pinNum = GetButtonAt(i).buttonState.pin;
 
-    DBG_PRINT_LN("FootPedalSetupManager::Setup() - buttonIndex = "  + String((int)i) + "; pin = " + String(pinNum) + ".");
+    DBG_PRINT_LN("FootPedalSetupManager::SetupImpl() - buttonIndex = "  + String((int)i) + "; pin = " + String(pinNum) + ".");
     pinMode(pinNum, INPUT_PULLUP);
   }
+#endif
 
   // Indicated that RH Arduino is ready.
   blinkOnce();
@@ -63,12 +68,12 @@ void FootPedalSetupManager::Setup()
   // if(!gIsSendMidi) { DbgPrintLn("RightHandSetup::Setup() - Setup done."); }
 }
 
-int FootPedalSetupManager::GetNumButtons()
+int FootPedalSetupManager::GetNumButtonsImpl()
 {
   return COUNT_ENTRIES(gFootPedalButtons);
 }
 
-Button& FootPedalSetupManager::GetButtonAt(int index)
+Button& FootPedalSetupManager::GetButtonAtImpl(int index)
 {
   return gFootPedalButtons[index];
 }
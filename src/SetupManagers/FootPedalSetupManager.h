@@ -30,14 +30,17 @@
 #include "SetupManagerBase.h"
 #include "../SharedConstants.h"
 
-class FootPedalSetupManager : public SetupManagerBase
+class FootPedalSetupManager : public SetupManagerBase<FootPedalSetupManager>
 {
+  friend class SetupManagerBase<FootPedalSetupManager>;
+
 public:
   FootPedalSetupManager();
 
-  void Setup();
-  int GetNumButtons();
-  Button& GetButtonAt(int index);
+private:
+  void SetupImpl();
+  int GetNumButtonsImpl();
+  Button& GetButtonAtImpl(int index);
 };
 
 #endif
@@ -24,19 +24,28 @@
   
  ******************************************************************************/
 
+
 #ifndef SetupManagerBase_H
 #define SetupManagerBase_H
 
 #include "../Button.h"
 
+// This class template provides an interface to set up the serial port and the button pins.
+// TDerived implements the methods with an Impl suffix; the calls are bound at compile time, so there is no virtual call.
+template <class TDerived>
 class SetupManagerBase
 {  
 public:
-  SetupManagerBase();
-  
-  virtual void Setup() = 0;
-  virtual int GetNumButtons() = 0;
-  virtual Button& GetButtonAt(int index) = 0;
+  void Setup() { Derived().SetupImpl(); }
+  int GetNumButtons() { return Derived().GetNumButtonsImpl(); }
+  Button& GetButtonAt(int index) { return Derived().GetButtonAtImpl(index); }
+
+protected:
+  // The constructor is protected; this class is only used as a base class.
+  SetupManagerBase() {}
+
+private:
+  TDerived& Derived() { return *static_cast<TDerived*>(this); }
 };
 
 #endif
@@ -29,10 +29,21 @@
 
 #include <Arduino.h>
 
+#include "MidiAccompanimentController.h"
+#include "PedalBoards.h"
+
 // Constants
+#ifdef READ_PEDALS_FROM_SHIFT_REGISTERS
+// Pin 13 is the SPI clock; connect the status LED to pin 7.
+const int LedPin = 7;
+#else
 const int LedPin = 13;
+#endif
 const uint32_t MidiEventFlashDurationMilliseconds = 10;
 
+// The LED on and off times of a counted indication; e.g., the registration bank number.
+const uint32_t IndicatorFlashStepMilliseconds = 150;
+
 // MIDI Baud rate is 31250 bits per second.
 const unsigned long BaudRateMidi = 31250;
 
@@ -40,12 +51,124 @@ const unsigned long BaudRateMidi = 31250;
 const unsigned long BaudRateSerialMonitor = 9600;
 // const unsigned long BaudRateSerialMonitor = 115200;
 
-const int NumFootPedalButtons = 13;
+#ifdef READ_PEDALS_FROM_SHIFT_REGISTERS
+// The number of chained 74HC165 shift registers; each one reads eight pedals.
+const int NumPedalShiftRegisters = 4;
+
+// The 74HC165 SH/LD (parallel load) pin. It is the SPI SS pin, which must be an output for SPI master mode.
+const uint8_t PedalShiftRegisterLoadPin = 10;
+
+// The SPI clock rate used to read the shift registers.
+const uint32_t PedalShiftRegisterClockHz = 4000000;
+
+// The number of pedals read as digital inputs, from their own pins or from shift registers.
+const int NumDigitalPedals = NumPedalShiftRegisters * 8;
+
+static_assert(NumBoardPedals <= NumDigitalPedals, "The pedal boards have more pedals than the shift registers have inputs.");
+#else
+// The pedal boards' pedals are each wired to their own pin.
+const int NumDigitalPedals = NumBoardPedals;
+#endif
+
+#ifdef READ_LADDER_PEDALS
+// The resistor ladder pedal board pin, and its number of pedals.
+const uint8_t LadderPedalPin = A3;
+const int NumLadderPedals = 4;
+
+// The ADC counts a ladder sample must move past the edge of the current level's band before it is classified again.
+const uint16_t LadderHysteresis = 8;
+
+// The number of consecutive samples at a new ladder level before the ladder pedals change.
+const uint8_t LadderStableSamples = 4;
+#else
+const int NumLadderPedals = 0;
+#endif
+
+#ifdef READ_EXPRESSION_PEDAL
+// The expression pedal pin, and the MIDI controller it sends to the accompaniment channels (7 = Channel Volume).
+const uint8_t ExpressionPedalPin = A4;
+const uint8_t ExpressionControlNumber = 7;
+
+// The number of ADC samples averaged per expression pedal reading.
+const uint8_t ExpressionOversampleCount = 16;
+
+// The ADC counts a reading must move past the edge of the current value's band before the value changes.
+const uint16_t ExpressionHysteresis = 3;
+
+// The minimum time between sent expression values. Each value is two Control Change messages (6 bytes),
+// so at most 600 bytes per second are sent; about a fifth of the 31250 baud MIDI link.
+const unsigned long ExpressionMinSendIntervalMs = 10;
+#endif
+
+// The number of pedals carried by the pedal link; the remote board's pedals, which are described by the same pedal boards.
+const int NumLinkedPedals = NumBoardPedals;
+
+// The time between pedal link frames without a pedal change, and the time without a frame after which the remote pedals are released.
+const unsigned long PedalLinkRefreshMs = 250;
+const unsigned long PedalLinkTimeoutMs = 1000;
+
+// The most configuration message bytes parsed per loop() iteration. At 31250 baud, about 3 bytes arrive per millisecond,
+// so the UART's 64-byte receive buffer does not overflow while loop() runs faster than every 5 ms.
+const uint8_t MaxSysExConfigBytesPerUpdate = 16;
+
+#ifdef RECEIVE_PEDAL_LINK
+const int NumRemotePedals = NumLinkedPedals;
+#else
+const int NumRemotePedals = 0;
+#endif
+
+// The ladder pedals, if any, follow the digital pedals, and the remote pedals, if any, follow them.
+const int LadderFirstPedalIndex = NumDigitalPedals;
+const int RemoteFirstPedalIndex = NumDigitalPedals + NumLadderPedals;
+const int NumFootPedalButtons = NumDigitalPedals + NumLadderPedals + NumRemotePedals;
 
 // The debounce time, in milliseconds. This is the duration to ignore button state changes.
 // It is an unsigned longs because the time, measured in milliseconds, will quickly become a bigger number than can be stored in an int.
 const unsigned long DebounceDelayMs = 25;
 
+// The largest configurable debounce time, in milliseconds.
+const uint8_t MaxDebounceDelayMs = 100;
+
+// The adaptive debounce settings. Each pedal's debounce time is its estimated 99th percentile bounce time plus AdaptiveDebounceMarginMs.
+const unsigned long AdaptiveDebounceMarginMs = 2;
+const unsigned long MinAdaptiveDebounceDelayMs = 3;
+
+// The time after a toggle during which raw changes are counted as bounce.
+const unsigned long BounceObservationWindowMs = DebounceDelayMs;
+
+// The number of bounces at or below a pedal's estimate that lower it by 1 ms.
+const uint8_t NumBouncesPerP99Decrement = 99;
+
+// The time to wait after an estimate changes before saving it to EEPROM.
+const unsigned long AdaptiveDebounceSaveDelayMs = 10000;
+
+// The number of performance journal records; each record's cells are written once per NumPerformanceJournalRecords records.
+const uint8_t NumPerformanceJournalRecords = 32;
+
+// The time to wait after the performance state changes before recording it.
+const unsigned long PerformanceJournalSaveDelayMs = 2000;
+
+// The vertical counter debounce sample tick, in milliseconds. A pedal must be stable for four ticks before its state changes.
+const uint8_t VerticalCounterSampleTickMs = 2;
+
+// The scheduled pedal scan period, in microseconds; i.e., the pedals are sampled at 1 kHz.
+const uint16_t PedalScanPeriodUs = 1000;
+
+// The gesture timings, in milliseconds. The gesture timer wheel advances every GestureTickMs, and has NumGestureWheelSlots slots.
+// Timeouts longer than one turn of the wheel (NumGestureWheelSlots * GestureTickMs) wait extra rounds.
+const uint8_t GestureTickMs = 10;
+const uint8_t NumGestureWheelSlots = 32;
+const uint16_t DoubleTapWindowMs = 250;
+const uint16_t LongPressMs = 600;
+const uint16_t HoldRepeatMs = 100;
+
+// The combo simultaneity window, in milliseconds. Combo pedals must all be pressed within this time of the first one.
+// It is also the largest time a combo pedal press is held back.
+const unsigned long ComboWindowMs = 40;
+
+// The quiet period, in milliseconds, without pedal changes after which the controller sleeps.
+const unsigned long IdleSleepDelayMs = 60000;
+
 const byte MaxMidiNotes = 128;
 const byte NumMidiChannels = 16;
 
@@ -0,0 +1,114 @@
+/*******************************************************************************
+  StaticButtonsManager.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef StaticButtonsManager_H
+#define StaticButtonsManager_H
+
+#include <Arduino.h>
+
+#include "MidiAccompanimentController.h"
+
+#include "Button.h"
+#include "PedalFlags.h"
+#include "SharedConstants.h"
+#include "ButtonChangedHandlers/PedalButtonChangedHandler.h"
+#include "PedalInputs/PedalPinMap.h"
+
+#ifdef DEBOUNCE_VERTICAL_COUNTER
+  #include "Debouncers/VerticalCounterDebouncer.h"
+#endif
+
+// This class template is a variant of ButtonsManager whose pedal pins are given at compile time by TPedalPinMap (a PedalPinMap).
+// The pedal scan is fully unrolled, with constant port bits; there is no runtime pin lookup, and no pin table in RAM.
+// The buttons passed to ReadButtons() hold the pedal states and debounce times, in TPedalPinMap order.
+template <class TPedalPinMap>
+class StaticButtonsManager {
+
+  static_assert(TPedalPinMap::NumPedals == NumFootPedalButtons, "The pedal pin map must contain NumFootPedalButtons pins.");
+
+public:
+  // This method sets the lockout debounce time; it is DebounceDelayMs until set.
+  void SetDebounceDelayMs(uint8_t debounceDelayMs) { mDebounceDelayMs = debounceDelayMs; }
+
+  // This method reads all pedals, and handles the ones that changed state.
+  void ReadButtons(Button* buttons, PedalButtonChangedHandler& buttonChangedHandler)
+  {
+#ifdef DEBOUNCE_VERTICAL_COUNTER
+    if (!mVerticalCounterDebouncer.IsSampleDue())
+    {
+      return;
+    }
+
+    PedalFlags pressedFlags = mVerticalCounterDebouncer.Update(TPedalPinMap::ReadPressedFlags());
+#else
+    PedalFlags pressedFlags = TPedalPinMap::ReadPressedFlags();
+#endif
+
+    PedalFlags changedFlags = pressedFlags ^ mCurFootPedalButtonFlags;
+    if (changedFlags == 0)
+    {
+      return;
+    }
+
+    PedalFlags buttonFlag = 1;
+    for (byte i = 0; changedFlags != 0; i++, buttonFlag <<= 1)
+    {
+      if ((changedFlags & buttonFlag) == 0)
+      {
+        continue;
+      }
+
+      changedFlags &= ~buttonFlag;
+
+#ifndef DEBOUNCE_VERTICAL_COUNTER
+      unsigned long curTimeMs = millis();
+      if (curTimeMs - buttons[i].lastToggleTimeMs < mDebounceDelayMs)
+      {
+        // Last button toggle time is too recent. Check it again on a later scan.
+        continue;
+      }
+
+      buttons[i].lastToggleTimeMs = curTimeMs;
+#endif
+
+      // Button state changed. Save its state.
+      mCurFootPedalButtonFlags ^= buttonFlag;
+      buttons[i].buttonState.active = (pressedFlags & buttonFlag) != 0;
+
+      buttonChangedHandler.HandleButtonChange(buttons, i);
+    }
+  }
+
+private:
+  PedalFlags mCurFootPedalButtonFlags = 0;
+  uint8_t mDebounceDelayMs = DebounceDelayMs;
+
+#ifdef DEBOUNCE_VERTICAL_COUNTER
+  VerticalCounterDebouncer mVerticalCounterDebouncer;
+#endif
+};
+
+#endif
@@ -104,8 +104,20 @@ void StatusManager::OnMidiEvent(MidiEventType midiEventType, uint8_t value, uint
   UpdateStatusIndicator();
 }
 
+void StatusManager::IndicateCount(uint8_t count)
+{
+  gMIDIEventFlasher.FlashCount(count);
+}
+
 void StatusManager::UpdateStatusIndicator()
 {
+  if (gMIDIEventFlasher.IsFlashingCount())
+  {
+    // The counted flashes are shown in every Status Indicator Mode.
+    gMIDIEventFlasher.UpdateStatusLed();
+    return;
+  }
+
   switch(mStatusIndicatorMode)
   {
     case StatusIndicatorMode::FlashMidiEvents:
@@ -128,6 +140,12 @@ void StatusManager::UpdateStatusIndicator()
   }
 }
 
+bool StatusManager::IsStatusIndicatorIdle()
+{
+  // The LED flash is timed; the note on indication is not.
+  return !gMIDIEventFlasher.IsFlashing();
+}
+
 bool StatusManager::IsAnyNoteOn()
 {
   for (int bank = 0; bank < NumNoteFlagBanks; bank++)
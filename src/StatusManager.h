@@ -69,6 +69,12 @@ public:
   // This method should periodically be called to update the Status Indicator LED.
   void UpdateStatusIndicator();
 
+  // This method flashes the Status Indicator LED count times, without blocking; e.g., to show the selected registration bank.
+  void IndicateCount(uint8_t count);
+
+  // This method returns true if the Status Indicator LED has no pending timed change.
+  bool IsStatusIndicatorIdle();
+
   // Clears the Note On Flags for the zero-based MIDI Channel, passed in.
   void ResetChannel(uint8_t midiChannelZeroBased);
 
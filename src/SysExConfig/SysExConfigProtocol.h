@@ -0,0 +1,108 @@
+/*******************************************************************************
+  SysExConfigProtocol.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef SysExConfigProtocol_H
+#define SysExConfigProtocol_H
+
+#include <Arduino.h>
+
+#include "../PedalLink/PedalLinkProtocol.h"
+
+// The configuration protocol edits the pedal configuration from a host, over MIDI IN, without reflashing.
+// Each message is a MIDI System Exclusive message; 8-bit values are sent as two bytes, high nibble first:
+// F0 7D 02 cc pp ... pp kk kk F7
+// 7D = non-commercial manufacturer ID; 02 = configuration message; cc = command; pp = the command's payload;
+// kk kk = CRC-8 of 02, cc and pp, high nibble first. It is the pedal link's CRC.
+//
+// The commands edit a staged copy of the configuration. Apply validates the staged copy, and replaces the configuration in use
+// between loop() iterations; Revert discards the edits. tools/sysex_config.py generates the messages.
+
+const uint8_t SysExConfigMessageType = 0x02;
+
+// The SysExConfigCommand enum contains the commands, and their payloads.
+enum SysExConfigCommand
+{
+  // Payload: pedal, edge, type, param0 (2 nibbles), param1 (2 nibbles). The params are 0..MaxPedalActionParam; checked on Apply.
+  SetPedalActionCommand = 0x01,
+
+  // Sets a pedal's press edge to select a style, and its release edge to no action. Payload: pedal, StyleNum (4 nibbles);
+  // its MSB and LSB are 7 bits, checked on Apply.
+  SetPedalStyleCommand = 0x02,
+
+  // Payload: default, minimum and maximum tempo (2 nibbles each).
+  SetTempoLimitsCommand = 0x03,
+
+  // Payload: the lockout debounce time in milliseconds, 1..MaxDebounceDelayMs. It is rejected when built with ADAPTIVE_DEBOUNCE
+  // or DEBOUNCE_VERTICAL_COUNTER, which do not use it.
+  SetDebounceCommand = 0x04,
+
+  // Payload: flags; SysExConfigPersistFlag also saves the configuration to EEPROM.
+  ApplyConfigCommand = 0x05,
+
+  // No payload.
+  RevertConfigCommand = 0x06
+};
+
+const uint8_t SysExConfigPersistFlag = 0x01;
+
+// The message bytes before the payload, and after it.
+const uint8_t NumSysExConfigHeaderBytes = 3;
+const uint8_t NumSysExConfigCrcBytes = 2;
+
+// The longest payload is SetPedalActionCommand's.
+const uint8_t MaxSysExConfigPayloadBytes = 7;
+
+// The message bytes between the start and end bytes.
+const uint8_t MaxSysExConfigMessageBytes = NumSysExConfigHeaderBytes + MaxSysExConfigPayloadBytes + NumSysExConfigCrcBytes;
+
+// This function returns the number of payload bytes of a command, or 0xFF if the command is not known.
+inline uint8_t GetSysExConfigPayloadSize(uint8_t command)
+{
+  switch (command)
+  {
+    case SysExConfigCommand::SetPedalActionCommand:
+      return 7;
+    case SysExConfigCommand::SetPedalStyleCommand:
+      return 5;
+    case SysExConfigCommand::SetTempoLimitsCommand:
+      return 6;
+    case SysExConfigCommand::SetDebounceCommand:
+    case SysExConfigCommand::ApplyConfigCommand:
+      return 1;
+    case SysExConfigCommand::RevertConfigCommand:
+      return 0;
+    default:
+      return 0xFF;
+  }
+}
+
+// This function returns the 8-bit value sent as two nibbles, high nibble first.
+inline uint8_t GetSysExNibblesValue(const uint8_t* nibbles)
+{
+  return (uint8_t)((nibbles[0] << 4) | (nibbles[1] & 0x0F));
+}
+
+#endif
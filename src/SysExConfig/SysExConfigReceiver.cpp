@@ -0,0 +1,246 @@
+/*******************************************************************************
+  SysExConfigReceiver.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#include "../MidiAccompanimentController.h"
+
+// Do not build unless receiving configuration messages.
+#ifdef RECEIVE_SYSEX_CONFIG
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+
+#include "SysExConfigReceiver.h"
+
+#include "../EepromLayout.h"
+#include "../FootPedalSwitchChangeManager.h"
+#include "../PedalConfigStore.h"
+#include "../SharedMacros.h"
+
+SysExConfigReceiver::SysExConfigReceiver(FootPedalSwitchChangeManager& footPedalSwitchChangeManager) :
+  mFootPedalSwitchChangeManager(footPedalSwitchChangeManager)
+{
+}
+
+// The configuration of registration bank 0 is staged, not the one in use, so applying or persisting it does not save the active bank.
+void SysExConfigReceiver::Setup()
+{
+  mStagedConfig = mFootPedalSwitchChangeManager.GetBaseConfig();
+}
+
+bool SysExConfigReceiver::Update()
+{
+  if (mSaveStep != NoSaveStep)
+  {
+    SaveNextByte();
+  }
+
+  bool isApplied = false;
+
+  for (uint8_t i = 0; i < MaxSysExConfigBytesPerUpdate && Serial.available() > 0; i++)
+  {
+    switch (mFrameParser.ParseByte(Serial.read()))
+    {
+      case SysExFrameParser<MaxSysExConfigMessageBytes>::FrameRestarted:
+      case SysExFrameParser<MaxSysExConfigMessageBytes>::FrameAborted:
+        // The message has no end byte. It may be another manufacturer's, so it is not counted.
+        break;
+
+      case SysExFrameParser<MaxSysExConfigMessageBytes>::FrameReceived:
+        isApplied |= HandleMessage();
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  return isApplied;
+}
+
+bool SysExConfigReceiver::HandleMessage()
+{
+  const uint8_t* messageBytes = mFrameParser.GetFrameBytes();
+  uint8_t numMessageBytes = mFrameParser.GetNumFrameBytes();
+
+  // Ignore System Exclusive messages that are not configuration messages.
+  if (numMessageBytes < 2 || messageBytes[0] != PedalLinkManufacturerId || messageBytes[1] != SysExConfigMessageType)
+  {
+    return false;
+  }
+
+  uint8_t command = numMessageBytes > 2 ? messageBytes[2] : 0;
+  uint8_t payloadSize = GetSysExConfigPayloadSize(command);
+  if (mFrameParser.IsFrameOverrun() || payloadSize == 0xFF || numMessageBytes != NumSysExConfigHeaderBytes + payloadSize + NumSysExConfigCrcBytes)
+  {
+    CountMessageError();
+    return false;
+  }
+
+  const uint8_t crcIndex = NumSysExConfigHeaderBytes + payloadSize;
+  if (GetPedalLinkCrc(&messageBytes[1], crcIndex - 1) != GetSysExNibblesValue(&messageBytes[crcIndex]))
+  {
+    CountMessageError();
+    return false;
+  }
+
+  // The staged configuration is being persisted; it must not change until it is written.
+  if (mSaveStep != NoSaveStep)
+  {
+    CountMessageError();
+    return false;
+  }
+
+  bool isApplied = false;
+  if (!HandleCommand(command, &messageBytes[NumSysExConfigHeaderBytes], isApplied))
+  {
+    CountMessageError();
+  }
+
+  return isApplied;
+}
+
+bool SysExConfigReceiver::HandleCommand(uint8_t command, const uint8_t* payload, bool& isApplied)
+{
+  switch (command)
+  {
+    case SysExConfigCommand::SetPedalActionCommand:
+    {
+      uint8_t pedal = payload[0];
+      uint8_t edge = payload[1];
+      if (pedal >= NumConfigurablePedals || edge >= PedalEdge::NumPedalEdges || payload[2] >= PedalActionType::NumPedalActionTypes)
+      {
+        return false;
+      }
+
+      mStagedConfig.pedalActions[pedal][edge] = PedalActionDescriptor{payload[2], GetSysExNibblesValue(&payload[3]), GetSysExNibblesValue(&payload[5])};
+      return true;
+    }
+
+    case SysExConfigCommand::SetPedalStyleCommand:
+    {
+      uint8_t pedal = payload[0];
+      if (pedal >= NumConfigurablePedals)
+      {
+        return false;
+      }
+
+      uint16_t styleNum = ((uint16_t)GetSysExNibblesValue(&payload[1]) << 8) | GetSysExNibblesValue(&payload[3]);
+      mStagedConfig.pedalActions[pedal][PedalEdge::PressEdge] = MakeSelectStyleAction(styleNum);
+      mStagedConfig.pedalActions[pedal][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::NoAction);
+      return true;
+    }
+
+    case SysExConfigCommand::SetTempoLimitsCommand:
+      // The limits are checked together, on Apply.
+      mStagedConfig.defaultTempo = GetSysExNibblesValue(&payload[0]);
+      mStagedConfig.minTempo = GetSysExNibblesValue(&payload[2]);
+      mStagedConfig.maxTempo = GetSysExNibblesValue(&payload[4]);
+      return true;
+
+    case SysExConfigCommand::SetDebounceCommand:
+#if defined(ADAPTIVE_DEBOUNCE) || defined(DEBOUNCE_VERTICAL_COUNTER)
+      // The adaptive and vertical counter debouncers do not use the lockout debounce time; setting it would have no effect.
+      return false;
+#else
+      mStagedConfig.debounceDelayMs = payload[0];
+      return true;
+#endif
+
+    case SysExConfigCommand::ApplyConfigCommand:
+      if (!PedalConfigStore::IsValid(mStagedConfig))
+      {
+        return false;
+      }
+
+      mFootPedalSwitchChangeManager.ApplyPedalConfig(mStagedConfig);
+      isApplied = true;
+
+      if (payload[0] & SysExConfigPersistFlag)
+      {
+        mSaveCrc = PedalConfigStore::GetCrc(mStagedConfig);
+        mSaveStep = 0;
+      }
+
+      DBG_PRINT_LN("SysExConfigReceiver::HandleCommand() - Applied; persist = " + String(mSaveStep == 0) + ".");
+      return true;
+
+    case SysExConfigCommand::RevertConfigCommand:
+      mStagedConfig = mFootPedalSwitchChangeManager.GetBaseConfig();
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+// The block is written as PedalConfigStore::Save() writes it: the version byte is invalidated first, and written last,
+// so a reset while saving leaves a block that fails to load. An EEPROM write takes about 3.3 ms; only one is started per call.
+void SysExConfigReceiver::SaveNextByte()
+{
+  if (!eeprom_is_ready())
+  {
+    return;
+  }
+
+  const uint8_t configSize = sizeof(PedalConfig);
+  uint8_t blockByte;
+  if (mSaveStep == 0)
+  {
+    blockByte = 0xFF;
+  }
+  else if (mSaveStep <= configSize)
+  {
+    blockByte = ((const uint8_t*)&mStagedConfig)[mSaveStep - 1];
+  }
+  else if (mSaveStep < EepromPedalConfigSize)
+  {
+    blockByte = ((const uint8_t*)&mSaveCrc)[mSaveStep - 1 - configSize];
+  }
+  else
+  {
+    EEPROM.update(EepromPedalConfigAddress, EepromPedalConfigVersion);
+    mSaveStep = NoSaveStep;
+
+    DBG_PRINT_LN("SysExConfigReceiver::SaveNextByte() - Saved.");
+    return;
+  }
+
+  EEPROM.update(EepromPedalConfigAddress + mSaveStep, blockByte);
+  mSaveStep++;
+}
+
+void SysExConfigReceiver::CountMessageError()
+{
+  if (mNumMessageErrors < 0xFFFF)
+  {
+    mNumMessageErrors++;
+  }
+
+  DBG_PRINT_LN("SysExConfigReceiver::CountMessageError() - Message errors = " + String(mNumMessageErrors) + ".");
+}
+
+#endif // RECEIVE_SYSEX_CONFIG
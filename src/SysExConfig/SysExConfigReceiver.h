@@ -0,0 +1,84 @@
+/*******************************************************************************
+  SysExConfigReceiver.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef SysExConfigReceiver_H
+#define SysExConfigReceiver_H
+
+#include <Arduino.h>
+
+#include "SysExConfigProtocol.h"
+#include "../PedalConfig.h"
+#include "../Utilities/SysExFrameParser.h"
+
+class FootPedalSwitchChangeManager;
+
+// This class receives configuration messages from the UART, and edits a staged copy of the pedal configuration.
+// It parses at most MaxSysExConfigBytesPerUpdate bytes per call, so a long configuration dump does not delay the pedal scan.
+// An Apply command replaces the configuration in use, from loop(), so a pedal change never sees a partly applied configuration.
+// A persisted configuration is written to EEPROM one byte per call, in PedalConfigStore's order; edits are rejected until it is written.
+// Messages with a bad length, CRC or value are dropped and counted. System Exclusive messages for other manufacturers are ignored.
+class SysExConfigReceiver {
+
+public:
+  // This method is the constructor. Applied configurations are sent to the Foot Pedal Switch Change Manager passed in.
+  SysExConfigReceiver(FootPedalSwitchChangeManager& footPedalSwitchChangeManager);
+
+  // This method stages the configuration of registration bank 0. It must be called from setup(), after the configuration is loaded.
+  void Setup();
+
+  // This method must be called from loop(). It returns true if a configuration was applied.
+  bool Update();
+
+  // This method returns the number of dropped messages.
+  uint16_t GetNumMessageErrors() const { return mNumMessageErrors; }
+
+private:
+  // This method handles a complete message. It returns true if a configuration was applied.
+  bool HandleMessage();
+
+  // This method handles a command's payload. It returns false if a value is not valid.
+  bool HandleCommand(uint8_t command, const uint8_t* payload, bool& isApplied);
+
+  // This method writes the next byte of the configuration being persisted.
+  void SaveNextByte();
+
+  void CountMessageError();
+
+private:
+  FootPedalSwitchChangeManager& mFootPedalSwitchChangeManager;
+
+  SysExFrameParser<MaxSysExConfigMessageBytes> mFrameParser;
+  PedalConfig mStagedConfig;
+
+  // The next EEPROM block byte to write, or NoSaveStep if the configuration is not being persisted.
+  static const uint8_t NoSaveStep = 0xFF;
+  uint8_t mSaveStep = NoSaveStep;
+  uint16_t mSaveCrc = 0;
+
+  uint16_t mNumMessageErrors = 0;
+};
+
+#endif
@@ -0,0 +1,109 @@
+/*******************************************************************************
+  EventRing.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+#ifndef EventRing_H
+#define EventRing_H
+
+#include <Arduino.h>
+
+#include <util/atomic.h>
+
+// This class template is a lock-free single-producer/single-consumer ring of events.
+// The producer (e.g., an ISR) calls Push(), and the consumer (e.g., loop()) calls Pop().
+// Each side writes only its own 8-bit index, which is read and written atomically on the AVR, so neither side disables interrupts.
+// NumEvents must be a power of two, no greater than 128. One slot is always kept empty to tell a full ring from an empty one.
+template <typename TEvent, uint8_t NumEvents>
+class EventRing {
+
+  static_assert(NumEvents >= 2 && NumEvents <= 128 && (NumEvents & (NumEvents - 1)) == 0, "NumEvents must be a power of two from 2 to 128.");
+
+public:
+  // This method adds an event to the ring. It returns false, and counts an overflow, if the ring is full.
+  // It must only be called by the producer.
+  bool Push(const TEvent& event)
+  {
+    uint8_t head = mHead;
+    uint8_t nextHead = (head + 1) & IndexMask;
+    if (nextHead == mTail)
+    {
+      if (mNumOverflows < 0xFFFF)
+      {
+        mNumOverflows++;
+      }
+
+      return false;
+    }
+
+    mEvents[head] = event;
+
+    // Ensure the event is stored before it is published to the consumer.
+    __asm__ __volatile__ ("" ::: "memory");
+    mHead = nextHead;
+
+    return true;
+  }
+
+  // This method removes the oldest event from the ring. It returns false if the ring is empty.
+  // It must only be called by the consumer.
+  bool Pop(TEvent& event)
+  {
+    uint8_t tail = mTail;
+    if (tail == mHead)
+    {
+      return false;
+    }
+
+    event = mEvents[tail];
+
+    // Ensure the event is copied before its slot is released to the producer.
+    __asm__ __volatile__ ("" ::: "memory");
+    mTail = (tail + 1) & IndexMask;
+
+    return true;
+  }
+
+  // This method returns the number of events that were dropped because the ring was full.
+  uint16_t GetNumOverflows() const
+  {
+    uint16_t numOverflows;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+      numOverflows = mNumOverflows;
+    }
+
+    return numOverflows;
+  }
+
+private:
+  static const uint8_t IndexMask = NumEvents - 1;
+
+  TEvent mEvents[NumEvents];
+  volatile uint8_t mHead = 0;
+  volatile uint8_t mTail = 0;
+  volatile uint16_t mNumOverflows = 0;
+};
+
+#endif
@@ -0,0 +1,126 @@
+/*******************************************************************************
+  SysExFrameParser.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+#ifndef SysExFrameParser_H
+#define SysExFrameParser_H
+
+#include <Arduino.h>
+
+const uint8_t SysExStartByte = 0xF0;
+const uint8_t SysExEndByte = 0xF7;
+
+// The System Real-Time status bytes, e.g., MIDI Clock and Active Sensing, are 0xF8 and up.
+const uint8_t FirstRealTimeByte = 0xF8;
+
+// This class template assembles MIDI System Exclusive messages from received bytes, one byte per call, so a caller can
+// bound the bytes it parses per loop() iteration. The bytes between the start and end bytes are kept, up to MaxFrameBytes;
+// a longer message is received to its end byte, and reported as overrun.
+template <uint8_t MaxFrameBytes>
+class SysExFrameParser
+{
+public:
+  // The ParseResult enum contains the results of parsing a byte.
+  enum ParseResult
+  {
+    // The byte is within a message, or outside any message.
+    NoFrame,
+
+    // The byte started a message.
+    FrameStarted,
+
+    // The byte started a message, but the previous message had no end byte.
+    FrameRestarted,
+
+    // The byte ended a message; its bytes are available until the next start byte.
+    FrameReceived,
+
+    // Another status byte ended the message before its end byte.
+    FrameAborted
+  };
+
+  // This method parses a received byte.
+  ParseResult ParseByte(uint8_t receivedByte)
+  {
+    // A System Real-Time message may be sent within a System Exclusive message; it is skipped, and the message continues.
+    if (receivedByte >= FirstRealTimeByte)
+    {
+      return ParseResult::NoFrame;
+    }
+
+    if (receivedByte == SysExStartByte)
+    {
+      bool wasInFrame = mIsInFrame;
+      mIsInFrame = true;
+      mIsFrameOverrun = false;
+      mNumFrameBytes = 0;
+      return wasInFrame ? ParseResult::FrameRestarted : ParseResult::FrameStarted;
+    }
+
+    if (!mIsInFrame)
+    {
+      return ParseResult::NoFrame;
+    }
+
+    if (receivedByte == SysExEndByte)
+    {
+      mIsInFrame = false;
+      return ParseResult::FrameReceived;
+    }
+
+    if ((receivedByte & 0x80) != 0)
+    {
+      // Any other status byte, except a System Real-Time byte, ends the System Exclusive message.
+      mIsInFrame = false;
+      return ParseResult::FrameAborted;
+    }
+
+    if (mNumFrameBytes < MaxFrameBytes)
+    {
+      mFrameBytes[mNumFrameBytes++] = receivedByte;
+    }
+    else
+    {
+      mIsFrameOverrun = true;
+    }
+
+    return ParseResult::NoFrame;
+  }
+
+  const uint8_t* GetFrameBytes() const { return mFrameBytes; }
+  uint8_t GetNumFrameBytes() const { return mNumFrameBytes; }
+
+  // This method returns true if the last message had more than MaxFrameBytes bytes.
+  bool IsFrameOverrun() const { return mIsFrameOverrun; }
+
+private:
+  uint8_t mFrameBytes[MaxFrameBytes];
+  uint8_t mNumFrameBytes = 0;
+  bool mIsInFrame = false;
+  bool mIsFrameOverrun = false;
+};
+
+#endif
@@ -83,6 +83,10 @@ String GetButtonInfo(Button* buttons, int buttonIndex)
 {
   String buttonInfo = String("Button[" + String(buttonIndex) + "] @ Pin " + String(buttons[buttonIndex].buttonState.pin) + " = " + String(buttons[buttonIndex].buttonState.active)); 
 
+#ifdef ADAPTIVE_DEBOUNCE
+  buttonInfo = buttonInfo + "; bounceP99Ms = " + String(buttons[buttonIndex].buttonState.bounceP99Ms);
+#endif
+
   return buttonInfo;
 }
 
@@ -32,14 +32,21 @@
 #include "MidiAccompanimentController.h" // MidiAccompanimentController.h contains compiler directives.
 
 #include "SetupManagers/FootPedalSetupManager.h"
-#include "ButtonChangedHandlers/FootPedalButtonChangedHandler.h"
+#include "ButtonChangedHandlers/PedalButtonChangedHandler.h"
+
+#ifdef SEND_PEDAL_LINK
+  #include "PedalLink/PedalLinkSender.h"
+#endif
 
 #include "FootPedalSwitchChangeManager.h"
 #include "MIDIEventFlasher.h"
+#include "MidiTransmitQueue.h"
+#include "PerformanceJournal.h"
 #include "StatusManager.h"
 
 
 #include "ButtonsManager.h"
+#include "StaticButtonsManager.h"
 #include "Utilities/Utilities.h"
 #include "SharedConstants.h"
 #include "SharedMacros.h"
@@ -48,37 +55,152 @@
   #include "Utilities/Diagnostics.h"
 #endif
 
-// Foot Switches Button configuration.
-Button gFootPedalButtons[NumFootPedalButtons] = {
-  // Button {ButtonState buttonState, unsigned long lastToggleTimeMs} where
-  // ButtonState {active, pin, unused0, unused1, unused2}
+#ifdef USE_FREE_RUNNING_ADC
+  #include "PedalInputs/FreeRunningAdc.h"
+#endif
 
-  // The Five-Pedal Board Buttons (Indexes 0..4)
-  {{false, 2, 0, 0, 0}, 0}, {{false, 3, 0, 0, 0}, 0}, {{false, 4, 0, 0, 0}, 0}, {{false, 5, 0, 0, 0}, 0},
-  {{false, 6, 0, 0, 0}, 0},
+#ifdef READ_EXPRESSION_PEDAL
+  #include "PedalInputs/ExpressionPedalInput.h"
+#endif
 
-  // The Eight-Pedal Board Buttons (Indexes 5..12)
-  {{false, 12, 0, 0, 0}, 0}, {{false, A0, 0, 0, 0}, 0}, {{false, A2, 0, 0, 0}, 0}, {{false, 11, 0, 0, 0}, 0}, 
-  {{false, A1, 0, 0, 0}, 0}, {{false, 8, 0, 0, 0}, 0}, {{false, 9, 0, 0, 0}, 0}, {{false, 10, 0, 0, 0}, 0}
-  };
+#ifdef DETECT_PEDAL_GESTURES
+  #include "GestureHandlers/FootPedalGestureHandler.h"
+  #include "PedalGestureEngine.h"
+#endif
+
+#ifdef DETECT_PEDAL_COMBOS
+  #include "PedalComboResolver.h"
+#endif
 
+#ifdef SLEEP_WHEN_IDLE
+  #include "IdleSleepManager.h"
+#endif
+
+#ifdef RECEIVE_SYSEX_CONFIG
+  #include "SysExConfig/SysExConfigReceiver.h"
+#endif
+
+// Foot Switches Button configuration.
+// The pedal board pins are set from the pedal boards in PedalBoards.h, by FootPedalSetupManager; the ladder and remote pedals, if any, follow them.
+// When reading pedals from shift registers, pedal N is shift register input N, and the pins are not used.
+// Button {ButtonState buttonState, unsigned long lastToggleTimeMs} is zero-initialized; lastToggleTimeMs is not present when DEBOUNCE_VERTICAL_COUNTER is defined.
+Button gFootPedalButtons[NumFootPedalButtons] = {};
+
+#ifdef USE_STATIC_PEDAL_PIN_MAP
+// The foot pedal pins are generated from the pedal boards, in button index order.
+StaticButtonsManager<BoardPedalPinMap> gStaticButtonsManager;
+#else
 ButtonsManager* pButtonsManager = new ButtonsManager(gFootPedalButtons);
+#endif
 
 FootPedalSetupManager setupManager;
-FootPedalButtonChangedHandler footPedalButtonChangedHandler;
 MIDIEventFlasher gMIDIEventFlasher;
+MidiTransmitQueue gMidiTransmitQueue;
 StatusManager gStatusManager;
-FootPedalSwitchChangeManager gFootPedalSwitchChangeManager;
+FootPedalSwitchChangeManager gFootPedalSwitchChangeManager(gStatusManager, gMidiTransmitQueue);
+PerformanceJournal gPerformanceJournal;
 
 #ifndef SEND_MIDI
 Diagnostics diagnostics;
 #endif
 
+#ifdef USE_FREE_RUNNING_ADC
+FreeRunningAdc gFreeRunningAdc;
+#endif
+
+#ifdef READ_EXPRESSION_PEDAL
+ExpressionPedalInput gExpressionPedalInput;
+#endif
+
+#ifdef DETECT_PEDAL_GESTURES
+FootPedalGestureHandler footPedalGestureHandler(gFootPedalSwitchChangeManager);
+PedalGestureEngine gPedalGestureEngine(footPedalGestureHandler);
+#endif
+
+#ifdef DETECT_PEDAL_COMBOS
+PedalComboResolver gPedalComboResolver(gFootPedalSwitchChangeManager);
+#endif
+
+#ifdef SLEEP_WHEN_IDLE
+IdleSleepManager gIdleSleepManager(gStatusManager, gMidiTransmitQueue, gPerformanceJournal
+#ifdef DETECT_PEDAL_GESTURES
+  , gPedalGestureEngine
+#endif
+#ifdef DETECT_PEDAL_COMBOS
+  , gPedalComboResolver
+#endif
+  );
+#endif
+
+#ifdef RECEIVE_SYSEX_CONFIG
+SysExConfigReceiver gSysExConfigReceiver(gFootPedalSwitchChangeManager);
+#endif
+
+// The pedal pipeline is composed at compile time: the buttons manager calls the handler, which calls the next stages, all without virtual calls.
+#ifdef SEND_PEDAL_LINK
+PedalLinkSender gPedalLinkSender;
+PedalButtonChangedHandler footPedalButtonChangedHandler(gPedalLinkSender);
+#else
+PedalButtonChangedHandler footPedalButtonChangedHandler(gFootPedalSwitchChangeManager
+#ifdef DETECT_PEDAL_COMBOS
+  , gPedalComboResolver
+#endif
+#ifdef DETECT_PEDAL_GESTURES
+  , gPedalGestureEngine
+#endif
+#ifdef SLEEP_WHEN_IDLE
+  , gIdleSleepManager
+#endif
+  );
+#endif
+
+// This function sets the pedal debounce time from the pedal configuration in use.
+void ApplyDebounceDelay()
+{
+  uint8_t debounceDelayMs = gFootPedalSwitchChangeManager.GetPedalConfig().debounceDelayMs;
+
+#ifdef USE_STATIC_PEDAL_PIN_MAP
+  gStaticButtonsManager.SetDebounceDelayMs(debounceDelayMs);
+#else
+  pButtonsManager->SetDebounceDelayMs(debounceDelayMs);
+#endif
+}
+
 // This function is called once, upon startup.
 void setup()
 {
   // Setup serial port and pin states.
   setupManager.Setup();
+  gFootPedalSwitchChangeManager.Setup();
+
+  PerformanceState performanceState;
+  if (gPerformanceJournal.Setup(performanceState))
+  {
+    gFootPedalSwitchChangeManager.RestorePerformanceState(performanceState);
+  }
+
+#ifndef USE_STATIC_PEDAL_PIN_MAP
+  pButtonsManager->Setup();
+#endif
+
+  ApplyDebounceDelay();
+
+#ifdef RECEIVE_SYSEX_CONFIG
+  gSysExConfigReceiver.Setup();
+#endif
+
+#ifdef READ_EXPRESSION_PEDAL
+  gExpressionPedalInput.Setup(gFreeRunningAdc);
+#endif
+
+#ifdef USE_FREE_RUNNING_ADC
+  // Start sampling after all analog inputs are added.
+  gFreeRunningAdc.Start();
+#endif
+
+#ifdef SLEEP_WHEN_IDLE
+  gIdleSleepManager.Setup(gFootPedalButtons, NumFootPedalButtons);
+#endif
 
   DBG_PRINT_LN("Setup() - Setup done.");
 }
@@ -86,8 +208,51 @@ void setup()
 // This function is called repeatedly.
 void loop()
 {
+#ifdef USE_STATIC_PEDAL_PIN_MAP
+  gStaticButtonsManager.ReadButtons(gFootPedalButtons, footPedalButtonChangedHandler);
+#else
   pButtonsManager->ReadButtons(gFootPedalButtons, 0, NumFootPedalButtons - 1, footPedalButtonChangedHandler);
+#endif
+
+#ifdef SEND_PEDAL_LINK
+  gPedalLinkSender.Update();
+#endif
+
+#ifdef DETECT_PEDAL_COMBOS
+  gPedalComboResolver.Update();
+#endif
+
+#ifdef DETECT_PEDAL_GESTURES
+  gPedalGestureEngine.Update();
+#endif
+
+#ifdef READ_EXPRESSION_PEDAL
+  uint8_t expressionValue;
+  if (gExpressionPedalInput.Update(expressionValue))
+  {
+    gFootPedalSwitchChangeManager.HandleExpressionChange(expressionValue);
+  }
+#endif
+
+  // Feed the queued MIDI messages to the UART, as its transmit buffer drains.
+  gMidiTransmitQueue.Update();
 
   gStatusManager.UpdateStatusIndicator();
+
+  // The journal's EEPROM writes are started here, after the pedals are handled.
+  gPerformanceJournal.Update(gFootPedalSwitchChangeManager.GetPerformanceState());
+
+#ifdef RECEIVE_SYSEX_CONFIG
+  // A configuration is applied after the pedals are handled, so it takes effect on the next iteration.
+  if (gSysExConfigReceiver.Update())
+  {
+    ApplyDebounceDelay();
+  }
+#endif
+
+#ifdef SLEEP_WHEN_IDLE
+  // Returns after waking; the next ReadButtons() handles the pedal that woke the controller.
+  gIdleSleepManager.Update();
+#endif
 }
 
@@ -0,0 +1,153 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+// This file times the dispatch of a pedal change from the button changed handler to the Foot Pedal Switch Change Manager on the Uno,
+// through FootPedalButtonChangedHandler's compile-time dispatch and through a virtual handler, and reports the CPU cycles per change.
+// The pedals have no actions, so no MIDI is sent, and the time is the dispatch and the action table lookup.
+// Run it on the board with "pio test -e uno".
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "ButtonChangedHandlers/FootPedalButtonChangedHandler.cpp"
+#include "FootPedalSwitchChangeManager.cpp"
+#include "MidiTransmitQueue.cpp"
+#include "PedalConfigStore.cpp"
+#include "StatusManager.cpp"
+#include "MIDIEventFlasher.cpp"
+#include "PedalBoards.cpp"
+#include "KeyboardProfiles/StyleCatalog.cpp"
+#include "Utilities/Utilities.cpp"
+
+MIDIEventFlasher gMIDIEventFlasher;
+StatusManager gStatusManager;
+
+// The number of pedal changes timed; micros() counts in steps of 4 us, so the per-change time is averaged over many changes.
+const uint16_t NumTimedChanges = 1000;
+
+// This class is the handler interface that the compile-time dispatch replaced; each change is a virtual call.
+class VirtualButtonChangedHandler
+{
+public:
+  virtual void HandleButtonChange(Button* buttons, byte buttonIndex) = 0;
+};
+
+class VirtualFootPedalButtonChangedHandler : public VirtualButtonChangedHandler
+{
+public:
+  VirtualFootPedalButtonChangedHandler(FootPedalSwitchChangeManager& footPedalSwitchChangeManager) :
+    mFootPedalSwitchChangeManager(footPedalSwitchChangeManager)
+  {
+  }
+
+  void HandleButtonChange(Button* buttons, byte buttonIndex) override
+  {
+    mFootPedalSwitchChangeManager.HandleButtonChange(buttonIndex, buttons[buttonIndex].buttonState.active);
+  }
+
+private:
+  FootPedalSwitchChangeManager& mFootPedalSwitchChangeManager;
+};
+
+static Button buttons[NumFootPedalButtons];
+static MidiTransmitQueue midiTransmitQueue;
+static FootPedalSwitchChangeManager footPedalSwitchChangeManager(gStatusManager, midiTransmitQueue);
+static FootPedalButtonChangedHandler footPedalButtonChangedHandler(footPedalSwitchChangeManager);
+static VirtualFootPedalButtonChangedHandler virtualFootPedalButtonChangedHandler(footPedalSwitchChangeManager);
+
+// The virtual handler is reached through a volatile pointer, so the compiler cannot bind the call at compile time.
+static VirtualButtonChangedHandler* volatile virtualButtonChangedHandler = &virtualFootPedalButtonChangedHandler;
+
+// This function returns the CPU cycles per pedal change of the dispatch function; each pedal is pressed and released in turn.
+static unsigned long TimeDispatch(void (*dispatch)(byte))
+{
+  unsigned long startTimeUs = micros();
+  for (uint16_t i = 0; i < NumTimedChanges; i++)
+  {
+    byte buttonIndex = (i >> 1) % NumFootPedalButtons;
+    buttons[buttonIndex].buttonState.active = (i & 1) == 0;
+    dispatch(buttonIndex);
+  }
+
+  unsigned long elapsedTimeUs = micros() - startTimeUs;
+  return elapsedTimeUs * (F_CPU / 1000000UL) / NumTimedChanges;
+}
+
+static void DispatchStatically(byte buttonIndex)
+{
+  footPedalButtonChangedHandler.HandleButtonChange(buttons, buttonIndex);
+}
+
+static void DispatchVirtually(byte buttonIndex)
+{
+  virtualButtonChangedHandler->HandleButtonChange(buttons, buttonIndex);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void TestStaticDispatchIsNoSlowerThanVirtualDispatch()
+{
+  unsigned long virtualCycles = TimeDispatch(DispatchVirtually);
+  unsigned long staticCycles = TimeDispatch(DispatchStatically);
+
+  char message[80];
+  snprintf(message, sizeof(message), "Cycles per pedal change: virtual handler %lu, compile-time handler %lu.", virtualCycles, staticCycles);
+  TEST_MESSAGE(message);
+
+  TEST_ASSERT_LESS_OR_EQUAL(virtualCycles, staticCycles);
+}
+
+void setup()
+{
+  // Wait for the test runner to open the serial port.
+  delay(2000);
+
+  footPedalSwitchChangeManager.Setup();
+
+  PedalConfig pedalConfig = footPedalSwitchChangeManager.GetPedalConfig();
+  for (uint8_t i = 0; i < NumConfigurablePedals; i++)
+  {
+    pedalConfig.pedalActions[i][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::NoAction);
+    pedalConfig.pedalActions[i][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::NoAction);
+  }
+
+  footPedalSwitchChangeManager.ApplyPedalConfig(pedalConfig);
+
+  UNITY_BEGIN();
+  RUN_TEST(TestStaticDispatchIsNoSlowerThanVirtualDispatch);
+  UNITY_END();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+// This file measures the period of PedalScanScheduler's Timer2 scans on the Uno, while loop() is busy,
+// and reports the shortest and longest periods and the jitter histogram. Run it on the board with "pio test -e uno".
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "MidiAccompanimentController.h"
+
+#define SCHEDULE_PEDAL_SCANS
+
+#include "PedalBoards.cpp"
+#include "PedalInputs/PedalPortScanner.cpp"
+#include "PedalInputs/PedalScanScheduler.cpp"
+
+// The time the scans are measured for; about one scan per millisecond.
+const unsigned long MeasureTimeMs = 5000;
+
+static Button buttons[NumFootPedalButtons];
+static PedalPortScanner pedalPortScanner;
+static PedalScanScheduler pedalScanScheduler;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void TestNoScanIsMissedWhileLoopIsBusy()
+{
+  // The loop is busy for a third of a scan period at a time, and takes the events the pedals make, as ButtonsManager does.
+  unsigned long startTimeMs = millis();
+  while (millis() - startTimeMs < MeasureTimeMs)
+  {
+    delayMicroseconds(PedalScanPeriodUs / 3);
+
+    PedalEvent pedalEvent;
+    while (pedalScanScheduler.PopEvent(pedalEvent))
+    {
+    }
+  }
+
+  ScanJitterStats scanJitterStats;
+  pedalScanScheduler.GetScanJitterStats(scanJitterStats);
+
+  char message[120];
+  snprintf(message, sizeof(message), "Scan period us: min %u, max %u; histogram of the jitter, %u us buckets: %u %u %u %u %u %u %u %u.",
+    scanJitterStats.minPeriodUs, scanJitterStats.maxPeriodUs, ScanJitterBucketUs,
+    scanJitterStats.numPeriodsPerBucket[0], scanJitterStats.numPeriodsPerBucket[1], scanJitterStats.numPeriodsPerBucket[2], scanJitterStats.numPeriodsPerBucket[3],
+    scanJitterStats.numPeriodsPerBucket[4], scanJitterStats.numPeriodsPerBucket[5], scanJitterStats.numPeriodsPerBucket[6], scanJitterStats.numPeriodsPerBucket[7]);
+  TEST_MESSAGE(message);
+
+  // A period of twice the scan period or more would be a missed scan.
+  TEST_ASSERT_LESS_THAN(2 * PedalScanPeriodUs, scanJitterStats.maxPeriodUs);
+  TEST_ASSERT_GREATER_THAN(0, scanJitterStats.minPeriodUs);
+  TEST_ASSERT_EQUAL_UINT16(0, pedalScanScheduler.GetNumOverflows());
+}
+
+void setup()
+{
+  // Wait for the test runner to open the serial port.
+  delay(2000);
+
+  SetupPedalBoardButtons(buttons);
+  for (uint8_t i = 0; i < NumDigitalPedals; i++)
+  {
+    pinMode(buttons[i].buttonState.pin, INPUT_PULLUP);
+  }
+
+  pedalPortScanner.Setup(buttons, NumDigitalPedals);
+  pedalScanScheduler.Setup(pedalPortScanner);
+
+  UNITY_BEGIN();
+  RUN_TEST(TestNoScanIsMissedWhileLoopIsBusy);
+  UNITY_END();
+}
+
+void loop()
+{
+}
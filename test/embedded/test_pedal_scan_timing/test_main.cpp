@@ -0,0 +1,137 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file times a scan of the foot pedals on the Uno, with digitalRead() per pedal, with PedalPortScanner
+// and with the compile-time BoardPedalPinMap, and reports the CPU cycles per scan. Run it on the board with "pio test -e uno".
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "PedalBoards.cpp"
+#include "PedalInputs/PedalPinMap.h"
+#include "PedalInputs/PedalPortScanner.cpp"
+
+// The number of scans timed; micros() counts in steps of 4 us, so the per-scan time is averaged over many scans.
+const uint16_t NumTimedScans = 1000;
+
+static Button buttons[NumFootPedalButtons];
+static PedalPortScanner pedalPortScanner;
+
+// The scans' results are accumulated here, so the scans are not optimized away.
+static volatile PedalFlags scannedFlags;
+
+// This function reads the pedals as ButtonsManager::ReadButtons() does without SCAN_PEDAL_PORTS; one digitalRead() per pedal.
+static PedalFlags ReadPressedFlagsPerPin()
+{
+  PedalFlags pressedFlags = 0;
+  for (uint8_t i = 0; i < NumDigitalPedals; i++)
+  {
+    if (digitalRead(buttons[i].buttonState.pin) == LOW)
+    {
+      pressedFlags |= (PedalFlags)1 << i;
+    }
+  }
+
+  return pressedFlags;
+}
+
+// This function returns the CPU cycles per scan of the scan function.
+static unsigned long TimeScan(PedalFlags (*scan)())
+{
+  unsigned long startTimeUs = micros();
+  for (uint16_t i = 0; i < NumTimedScans; i++)
+  {
+    scannedFlags ^= scan();
+  }
+
+  unsigned long elapsedTimeUs = micros() - startTimeUs;
+  return elapsedTimeUs * (F_CPU / 1000000UL) / NumTimedScans;
+}
+
+static PedalFlags ReadPressedFlagsFromPorts()
+{
+  return pedalPortScanner.ReadPressedFlags();
+}
+
+static PedalFlags ReadPressedFlagsFromPinMap()
+{
+  return BoardPedalPinMap::ReadPressedFlags();
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void TestPortSnapshotScanIsFasterThanPerPinScan()
+{
+  unsigned long perPinCycles = TimeScan(ReadPressedFlagsPerPin);
+  unsigned long portSnapshotCycles = TimeScan(ReadPressedFlagsFromPorts);
+
+  char message[80];
+  snprintf(message, sizeof(message), "Cycles per scan of %d pedals: digitalRead() %lu, port snapshot %lu.", NumDigitalPedals, perPinCycles, portSnapshotCycles);
+  TEST_MESSAGE(message);
+
+  TEST_ASSERT_LESS_THAN(perPinCycles, portSnapshotCycles);
+}
+
+void TestStaticPinMapScanIsFasterThanPortScanner()
+{
+  unsigned long portSnapshotCycles = TimeScan(ReadPressedFlagsFromPorts);
+  unsigned long pinMapCycles = TimeScan(ReadPressedFlagsFromPinMap);
+
+  char message[80];
+  snprintf(message, sizeof(message), "Cycles per scan of %d pedals: port snapshot %lu, static pin map %lu.", NumDigitalPedals, portSnapshotCycles, pinMapCycles);
+  TEST_MESSAGE(message);
+
+  TEST_ASSERT_LESS_THAN(portSnapshotCycles, pinMapCycles);
+}
+
+void setup()
+{
+  // Wait for the test runner to open the serial port.
+  delay(2000);
+
+  SetupPedalBoardButtons(buttons);
+  for (uint8_t i = 0; i < NumDigitalPedals; i++)
+  {
+    pinMode(buttons[i].buttonState.pin, INPUT_PULLUP);
+  }
+
+  pedalPortScanner.Setup(buttons, NumDigitalPedals);
+
+  UNITY_BEGIN();
+  RUN_TEST(TestPortSnapshotScanIsFasterThanPerPinScan);
+  RUN_TEST(TestStaticPinMapScanIsFasterThanPortScanner);
+  UNITY_END();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+  Arduino.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file stands in for the Arduino core in the native unit tests. It simulates the digital pins, on the input ports of avr/io.h,
+// and the millis() and micros() clocks, which the tests set; see the Host functions. The Serial port is in HardwareSerial.h.
+
+#ifndef Arduino_H
+#define Arduino_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+// The C++ library headers that the stand-ins use must be included before the min() and max() macros.
+#include "HardwareSerial.h"
+#include "WString.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define MSBFIRST 1
+
+#define HEX 16
+#define BIN 2
+
+#define bit(b) (1UL << (b))
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(x, low, high) ((x) < (low) ? (low) : ((x) > (high) ? (high) : (x)))
+
+// The Uno's analog pins, which are also digital pins 14 to 19.
+enum { A0 = 14, A1, A2, A3, A4, A5 };
+
+inline uint8_t digitalPinToPort(uint8_t pin)
+{
+  return pin < 8 ? PD : (pin < 14 ? PB : PC);
+}
+
+inline uint8_t digitalPinToBitMask(uint8_t pin)
+{
+  return (uint8_t)(1 << (pin < 8 ? pin : (pin < 14 ? pin - 8 : pin - 14)));
+}
+
+// This function sets the simulated level of the pin; the pedal pins are pulled up, so LOW is pressed.
+inline void HostSetPinLevel(uint8_t pin, uint8_t level)
+{
+  volatile uint8_t& portInputRegister = HostPortInputRegister(digitalPinToPort(pin));
+  if (level == LOW)
+  {
+    portInputRegister &= ~digitalPinToBitMask(pin);
+  }
+  else
+  {
+    portInputRegister |= digitalPinToBitMask(pin);
+  }
+}
+
+inline int digitalRead(uint8_t pin)
+{
+  return (HostPortInputRegister(digitalPinToPort(pin)) & digitalPinToBitMask(pin)) != 0 ? HIGH : LOW;
+}
+
+// This function returns the level last written to the pin.
+inline uint8_t& HostPinOutputLevel(uint8_t pin)
+{
+  static uint8_t pinOutputLevels[20] = {};
+  return pinOutputLevels[pin];
+}
+
+// This function returns the number of times LOW was written to the pin; e.g., the load pulses of a shift register.
+inline uint16_t& HostPinLowWriteCount(uint8_t pin)
+{
+  static uint16_t pinLowWriteCounts[20] = {};
+  return pinLowWriteCounts[pin];
+}
+
+inline void digitalWrite(uint8_t pin, uint8_t level)
+{
+  HostPinOutputLevel(pin) = level;
+  if (level == LOW)
+  {
+    HostPinLowWriteCount(pin)++;
+  }
+}
+
+inline void pinMode(uint8_t, uint8_t)
+{
+}
+
+// This function returns the simulated time, in microseconds; millis() is derived from it.
+// As on the Uno, micros() and millis() roll over at 32 bits; unsigned long is wider on most hosts.
+inline uint64_t& HostMicros()
+{
+  static uint64_t curTimeUs = 0;
+  return curTimeUs;
+}
+
+inline void HostSetMillis(uint32_t timeMs)
+{
+  HostMicros() = (uint64_t)timeMs * 1000;
+}
+
+inline void HostAdvanceMillis(uint32_t elapsedMs)
+{
+  HostMicros() += (uint64_t)elapsedMs * 1000;
+}
+
+inline unsigned long micros()
+{
+  return (uint32_t)HostMicros();
+}
+
+inline unsigned long millis()
+{
+  return (uint32_t)(HostMicros() / 1000);
+}
+
+// This function advances the simulated time instead of waiting.
+inline void delay(unsigned long elapsedMs)
+{
+  HostAdvanceMillis(elapsedMs);
+}
+
+#endif
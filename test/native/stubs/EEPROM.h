@@ -0,0 +1,51 @@
+/*******************************************************************************
+  EEPROM.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file stands in for the Arduino EEPROM library in the native unit tests; it uses the EEPROM array of avr/eeprom.h.
+
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <avr/eeprom.h>
+
+class EEPROMClass
+{
+public:
+  uint8_t read(int address) { return eeprom_read_byte((const uint8_t*)(uintptr_t)address); }
+  void write(int address, uint8_t value) { eeprom_write_byte((uint8_t*)(uintptr_t)address, value); }
+  void update(int address, uint8_t value) { eeprom_update_byte((uint8_t*)(uintptr_t)address, value); }
+  uint16_t length() { return E2END + 1; }
+};
+
+inline EEPROMClass& HostEepromClass()
+{
+  static EEPROMClass eeprom;
+  return eeprom;
+}
+
+#define EEPROM (HostEepromClass())
+
+#endif
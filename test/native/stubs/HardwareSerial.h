@@ -0,0 +1,107 @@
+/*******************************************************************************
+  HardwareSerial.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file stands in for the Arduino Serial port in the native unit tests. The bytes written are recorded, the transmit
+// buffer's free space, as availableForWrite() returns it, is set by the tests, and so are the bytes received; see the Host functions.
+
+#ifndef HardwareSerial_H
+#define HardwareSerial_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "WString.h"
+
+// The free space of the Uno's transmit buffer, when it is empty.
+const int HostSerialTransmitBufferSize = 63;
+
+class HardwareSerial
+{
+public:
+  void begin(unsigned long) {}
+  void flush() {}
+
+  int availableForWrite() { return mNumFreeBytes; }
+
+  size_t write(uint8_t writtenByte)
+  {
+    mWrittenBytes.push_back(writtenByte);
+    if (mNumFreeBytes > 0)
+    {
+      mNumFreeBytes--;
+    }
+
+    return 1;
+  }
+
+  size_t write(const uint8_t* bytes, size_t numBytes)
+  {
+    for (size_t i = 0; i < numBytes; i++)
+    {
+      write(bytes[i]);
+    }
+
+    return numBytes;
+  }
+
+  int available() { return (int)(mReceivedBytes.size() - mNumReadBytes); }
+  int peek() { return available() > 0 ? mReceivedBytes[mNumReadBytes] : -1; }
+  int read() { return available() > 0 ? mReceivedBytes[mNumReadBytes++] : -1; }
+
+  // Text is not recorded; only the debug builds print.
+  size_t print(const String&) { return 0; }
+  size_t println(const String&) { return 0; }
+
+  // This method returns the bytes written; the tests clear it between steps.
+  std::vector<uint8_t>& HostWrittenBytes() { return mWrittenBytes; }
+
+  // This method sets the free space of the transmit buffer; e.g., to simulate the UART draining it.
+  void HostSetNumFreeBytes(int numFreeBytes) { mNumFreeBytes = numFreeBytes; }
+
+  // This method adds bytes to be read; the bytes already read are discarded.
+  void HostReceiveBytes(const std::vector<uint8_t>& bytes)
+  {
+    mReceivedBytes.erase(mReceivedBytes.begin(), mReceivedBytes.begin() + mNumReadBytes);
+    mNumReadBytes = 0;
+    mReceivedBytes.insert(mReceivedBytes.end(), bytes.begin(), bytes.end());
+  }
+
+private:
+  std::vector<uint8_t> mReceivedBytes;
+  size_t mNumReadBytes = 0;
+  std::vector<uint8_t> mWrittenBytes;
+  int mNumFreeBytes = HostSerialTransmitBufferSize;
+};
+
+inline HardwareSerial& HostSerial()
+{
+  static HardwareSerial serial;
+  return serial;
+}
+
+#define Serial (HostSerial())
+
+#endif
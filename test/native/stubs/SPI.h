@@ -0,0 +1,87 @@
+/*******************************************************************************
+  SPI.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file stands in for the Arduino SPI library in the native unit tests. Each transferred byte is passed to the
+// function set with HostSetSpiTransfer(), which simulates the SPI device and returns the byte it sends back.
+
+#ifndef SPI_H
+#define SPI_H
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+
+class SPISettings {
+
+public:
+  SPISettings(uint32_t, uint8_t, uint8_t)
+  {
+  }
+};
+
+typedef uint8_t (*HostSpiTransferFunction)(uint8_t sentByte);
+
+inline HostSpiTransferFunction& HostSpiTransfer()
+{
+  static HostSpiTransferFunction spiTransfer = NULL;
+  return spiTransfer;
+}
+
+inline void HostSetSpiTransfer(HostSpiTransferFunction spiTransfer)
+{
+  HostSpiTransfer() = spiTransfer;
+}
+
+class SPIClass {
+
+public:
+  void begin()
+  {
+  }
+
+  void beginTransaction(const SPISettings&)
+  {
+  }
+
+  void endTransaction()
+  {
+  }
+
+  uint8_t transfer(uint8_t sentByte)
+  {
+    return HostSpiTransfer() != NULL ? HostSpiTransfer()(sentByte) : 0xFF;
+  }
+};
+
+inline SPIClass& HostSpi()
+{
+  static SPIClass spi;
+  return spi;
+}
+
+#define SPI (HostSpi())
+
+#endif
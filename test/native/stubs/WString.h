@@ -0,0 +1,87 @@
+/*******************************************************************************
+  WString.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file stands in for the Arduino String class in the native unit tests; it holds a std::string.
+
+#ifndef WString_H
+#define WString_H
+
+#include <stdio.h>
+#include <string>
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(PSTR(s)))
+
+class String
+{
+public:
+  String() {}
+  String(const char* text) : mText(text != NULL ? text : "") {}
+  String(const __FlashStringHelper* text) : mText(reinterpret_cast<const char*>(text)) {}
+  String(char c) : mText(1, c) {}
+  String(unsigned char value, unsigned char base = 10) { SetNumber(value, base); }
+  String(int value, unsigned char base = 10) { SetNumber(value, base); }
+  String(unsigned int value, unsigned char base = 10) { SetNumber(value, base); }
+  String(long value, unsigned char base = 10) { SetNumber(value, base); }
+  String(unsigned long value, unsigned char base = 10) { SetNumber(value, base); }
+
+  unsigned int length() const { return mText.length(); }
+  const char* c_str() const { return mText.c_str(); }
+
+  String& operator+=(const String& other) { mText += other.mText; return *this; }
+  friend String operator+(const String& left, const String& right) { String result(left); return result += right; }
+  friend String operator+(const char* left, const String& right) { return String(left) + right; }
+  friend String operator+(char left, const String& right) { return String(left) + right; }
+
+private:
+  void SetNumber(long value, unsigned char base)
+  {
+    if (value < 0 && base == 10)
+    {
+      mText = "-";
+      SetDigits((unsigned long)-value, base, true);
+      return;
+    }
+
+    SetDigits((unsigned long)value, base, false);
+  }
+
+  void SetDigits(unsigned long value, unsigned char base, bool isAppended)
+  {
+    std::string digits;
+    do
+    {
+      digits.insert(digits.begin(), "0123456789ABCDEF"[value % base]);
+      value /= base;
+    } while (value != 0);
+
+    mText = isAppended ? mText + digits : digits;
+  }
+
+  std::string mText;
+};
+
+#endif
@@ -0,0 +1,111 @@
+/*******************************************************************************
+  eeprom.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file stands in for avr/eeprom.h in the native unit tests. The EEPROM is an erased array; writes complete at once,
+// and are counted per cell.
+
+#ifndef eeprom_H
+#define eeprom_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define E2END 1023
+
+inline uint8_t* HostEeprom()
+{
+  static uint8_t eepromBytes[E2END + 1];
+  static bool isErased = false;
+  if (!isErased)
+  {
+    memset(eepromBytes, 0xFF, sizeof(eepromBytes));
+    isErased = true;
+  }
+
+  return eepromBytes;
+}
+
+// This function returns the number of times each cell was written, to check the wear; the tests clear it.
+inline uint32_t* HostEepromWriteCounts()
+{
+  static uint32_t writeCounts[E2END + 1];
+  return writeCounts;
+}
+
+// This function writes a cell, and counts the write.
+inline void HostWriteEepromByte(uintptr_t address, uint8_t value)
+{
+  HostEeprom()[address] = value;
+  HostEepromWriteCounts()[address]++;
+}
+
+inline uint8_t eeprom_read_byte(const uint8_t* address)
+{
+  return HostEeprom()[(uintptr_t)address];
+}
+
+// As on the AVR, an update writes only the cells whose value changes.
+inline void eeprom_update_byte(uint8_t* address, uint8_t value)
+{
+  if (HostEeprom()[(uintptr_t)address] != value)
+  {
+    HostWriteEepromByte((uintptr_t)address, value);
+  }
+}
+
+inline void eeprom_write_byte(uint8_t* address, uint8_t value)
+{
+  HostWriteEepromByte((uintptr_t)address, value);
+}
+
+inline void eeprom_read_block(void* destination, const void* address, size_t numBytes)
+{
+  memcpy(destination, HostEeprom() + (uintptr_t)address, numBytes);
+}
+
+inline void eeprom_update_block(const void* source, void* address, size_t numBytes)
+{
+  for (size_t i = 0; i < numBytes; i++)
+  {
+    eeprom_update_byte((uint8_t*)address + i, ((const uint8_t*)source)[i]);
+  }
+}
+
+inline void eeprom_write_block(const void* source, void* address, size_t numBytes)
+{
+  for (size_t i = 0; i < numBytes; i++)
+  {
+    eeprom_write_byte((uint8_t*)address + i, ((const uint8_t*)source)[i]);
+  }
+}
+
+inline bool eeprom_is_ready()
+{
+  return true;
+}
+
+#endif
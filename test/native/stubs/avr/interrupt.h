@@ -1,5 +1,5 @@
 /*******************************************************************************
-  SetupManagerBase.cpp
+  interrupt.h
   
   MIDI Accompaniment Controller
   https://github.com/BarryKVibes/MidiAccompanimentController
@@ -24,8 +24,14 @@
   
  ******************************************************************************/
 
-#include "SetupManagerBase.h"
+// This file stands in for avr/interrupt.h in the native unit tests. An ISR is an ordinary function, which the tests call.
 
-SetupManagerBase::SetupManagerBase()
-{
-}
+#ifndef interrupt_H
+#define interrupt_H
+
+#define ISR(vector) extern "C" void vector()
+
+#define cli()
+#define sei()
+
+#endif
@@ -0,0 +1,80 @@
+/*******************************************************************************
+  io.h
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file stands in for avr/io.h in the native unit tests. The I/O registers the firmware uses are simulated as variables,
+// which the tests set and check.
+
+#ifndef io_H
+#define io_H
+
+#include <stdint.h>
+
+// The Uno's ports, as returned by digitalPinToPort(): pins 0..7 are port D, 8..13 port B, and 14..19 port C.
+#define PB 2
+#define PC 3
+#define PD 4
+
+// This function returns the simulated input register of the port; its bits are the levels of the port's pins, which are pulled up.
+inline volatile uint8_t& HostPortInputRegister(uint8_t port)
+{
+  static volatile uint8_t portInputRegisters[3] = {0xFF, 0xFF, 0xFF};
+  return portInputRegisters[port - PB];
+}
+
+#define PINB (HostPortInputRegister(PB))
+#define PINC (HostPortInputRegister(PC))
+#define PIND (HostPortInputRegister(PD))
+
+// This function returns the simulated 8-bit register at the data memory address.
+inline volatile uint8_t& HostRegister8(uint8_t address)
+{
+  static volatile uint8_t registers[0x100];
+  return registers[address];
+}
+
+// The ADC registers, and their bits.
+#define ADC (HostAdcDataRegister())
+#define ADCSRA (HostRegister8(0x7A))
+#define ADCSRB (HostRegister8(0x7B))
+#define ADMUX (HostRegister8(0x7C))
+#define DIDR0 (HostRegister8(0x7E))
+
+inline volatile uint16_t& HostAdcDataRegister()
+{
+  static volatile uint16_t adcDataRegister;
+  return adcDataRegister;
+}
+
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE 3
+#define ADATE 5
+#define ADSC 6
+#define ADEN 7
+#define REFS0 6
+
+#endif
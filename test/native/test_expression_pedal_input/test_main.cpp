@@ -0,0 +1,111 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests ExpressionPedalInput's send decisions, and its counters, past 65535 readings and sent values.
+
+#include <unity.h>
+
+#define READ_EXPRESSION_PEDAL
+
+#include "PedalInputs/FreeRunningAdc.cpp"
+#include "PedalInputs/ExpressionPedalInput.cpp"
+
+FreeRunningAdc gFreeRunningAdc;
+
+void setUp()
+{
+  HostSetMillis(1000);
+}
+
+void tearDown()
+{
+}
+
+void TestFirstReadingIsSent()
+{
+  ExpressionPedalInput expressionPedalInput;
+  expressionPedalInput.Setup(gFreeRunningAdc);
+
+  uint8_t value = 0;
+  TEST_ASSERT_FALSE(expressionPedalInput.Update(value));
+
+  expressionPedalInput.FilterReading(0);
+  TEST_ASSERT_TRUE(expressionPedalInput.Update(value));
+  TEST_ASSERT_EQUAL_UINT8(0, value);
+  TEST_ASSERT_FALSE(expressionPedalInput.Update(value));
+}
+
+void TestReadingCountSaturates()
+{
+  ExpressionPedalInput expressionPedalInput;
+  expressionPedalInput.Setup(gFreeRunningAdc);
+
+  for (uint32_t i = 0; i < 0x10000; i++)
+  {
+    expressionPedalInput.FilterReading(i % 2 == 0 ? 1023 : 0);
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(0xFFFF, expressionPedalInput.GetNumReadings());
+  TEST_ASSERT_EQUAL_UINT16(0xFFFF, expressionPedalInput.GetNumValueChanges());
+
+  // The reading count no longer wraps to 0, which stopped the value from being sent.
+  uint8_t value = 0xFF;
+  TEST_ASSERT_TRUE(expressionPedalInput.Update(value));
+  TEST_ASSERT_EQUAL_UINT8(0, value);
+}
+
+void TestSendIntervalHoldsAfterManySends()
+{
+  ExpressionPedalInput expressionPedalInput;
+  expressionPedalInput.Setup(gFreeRunningAdc);
+
+  uint8_t value;
+  for (uint32_t i = 0; i < 0x10000; i++)
+  {
+    HostAdvanceMillis(ExpressionMinSendIntervalMs);
+    expressionPedalInput.FilterReading(i % 2 == 0 ? 1023 : 0);
+    TEST_ASSERT_TRUE(expressionPedalInput.Update(value));
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(0xFFFF, expressionPedalInput.GetNumSentValues());
+
+  // The sent value count no longer wraps to 0, which let a value be sent before the send interval elapsed.
+  HostAdvanceMillis(ExpressionMinSendIntervalMs - 1);
+  expressionPedalInput.FilterReading(1023);
+  TEST_ASSERT_FALSE(expressionPedalInput.Update(value));
+
+  HostAdvanceMillis(1);
+  TEST_ASSERT_TRUE(expressionPedalInput.Update(value));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestFirstReadingIsSent);
+  RUN_TEST(TestReadingCountSaturates);
+  RUN_TEST(TestSendIntervalHoldsAfterManySends);
+  return UNITY_END();
+}
@@ -0,0 +1,330 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests the order and coalescing of the MIDI messages queued by MidiTransmitQueue, while the UART is busy.
+// The bytes written are played into a model of the keyboard, and its final state is checked.
+
+#include <unity.h>
+
+#include "FootPedalSwitchChangeManager.cpp"
+#include "MidiTransmitQueue.cpp"
+#include "PedalConfigStore.cpp"
+#include "StatusManager.cpp"
+#include "MIDIEventFlasher.cpp"
+#include "PedalBoards.cpp"
+#include "KeyboardProfiles/StyleCatalog.cpp"
+#include "Utilities/Utilities.cpp"
+
+MIDIEventFlasher gMIDIEventFlasher;
+StatusManager gStatusManager;
+
+// The pedals of the test configuration.
+enum TestPedal
+{
+  StylePedal,
+  TempoUpPedal,
+  NextSongPedal,
+  MainAPedal,
+  MainBPedal
+};
+
+// The state of the keyboard, after the written SysEx messages: the style, the tempo in BPM, the last section switched on,
+// and the section switches that are held on.
+struct KeyboardState
+{
+  uint16_t styleNum;
+  uint16_t tempo;
+  uint8_t sectionSwitchNum;
+  uint64_t heldSwitches;
+};
+
+MidiTransmitQueue* gMidiTransmitQueue;
+FootPedalSwitchChangeManager* gFootPedalSwitchChangeManager;
+
+void setUp()
+{
+  memset(HostEeprom(), 0xFF, E2END + 1);
+  HostSerial().HostWrittenBytes().clear();
+  HostSerial().HostSetNumFreeBytes(HostSerialTransmitBufferSize);
+
+  gMidiTransmitQueue = new MidiTransmitQueue();
+  gFootPedalSwitchChangeManager = new FootPedalSwitchChangeManager(gStatusManager, *gMidiTransmitQueue);
+  gFootPedalSwitchChangeManager->Setup();
+
+  PedalConfig pedalConfig = gFootPedalSwitchChangeManager->GetPedalConfig();
+  for (uint8_t i = 0; i < NumConfigurablePedals; i++)
+  {
+    pedalConfig.pedalActions[i][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::NoAction);
+    pedalConfig.pedalActions[i][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::NoAction);
+  }
+
+  pedalConfig.pedalActions[StylePedal][PedalEdge::PressEdge] = MakeSelectStyleAction(StyleNum::CoolBossa);
+  pedalConfig.pedalActions[TempoUpPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::TempoUp);
+  pedalConfig.pedalActions[NextSongPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::NextSong);
+  pedalConfig.pedalActions[MainAPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::MainA);
+  pedalConfig.pedalActions[MainAPedal][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::MainA);
+  pedalConfig.pedalActions[MainBPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::MainB);
+  pedalConfig.pedalActions[MainBPedal][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::MainB);
+  pedalConfig.defaultTempo = 120;
+  gFootPedalSwitchChangeManager->ApplyPedalConfig(pedalConfig);
+
+  // The UART's transmit buffer is full, so the messages are queued.
+  HostSerial().HostSetNumFreeBytes(0);
+}
+
+void tearDown()
+{
+  delete gFootPedalSwitchChangeManager;
+  delete gMidiTransmitQueue;
+}
+
+void PressPedal(uint8_t buttonIndex)
+{
+  gFootPedalSwitchChangeManager->HandleButtonChange(buttonIndex, true);
+}
+
+void ReleasePedal(uint8_t buttonIndex)
+{
+  gFootPedalSwitchChangeManager->HandleButtonChange(buttonIndex, false);
+}
+
+// This function lets the UART drain the queue.
+void DrainQueue()
+{
+  while (!gMidiTransmitQueue->IsIdle())
+  {
+    HostSerial().HostSetNumFreeBytes(HostSerialTransmitBufferSize);
+    gMidiTransmitQueue->Update();
+  }
+}
+
+// This function plays the written bytes into the keyboard model; each message must be whole, and known.
+KeyboardState GetKeyboardState()
+{
+  KeyboardState state = {0, 0, UnknownSectionSwitchNum, 0};
+  const std::vector<uint8_t>& bytes = HostSerial().HostWrittenBytes();
+  size_t i = 0;
+  while (i < bytes.size())
+  {
+    size_t end = i;
+    while (end < bytes.size() && bytes[end] != 0xF7)
+    {
+      end++;
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(end < bytes.size(), "A message is not whole.");
+    TEST_ASSERT_EQUAL_HEX8(0xF0, bytes[i]);
+    const uint8_t* message = &bytes[i];
+    size_t numMessageBytes = end + 1 - i;
+
+    if (numMessageBytes == sizeof(KeyboardStyleSelectSysExTemplate) && message[2] == 0x73)
+    {
+      state.styleNum = (uint16_t)(message[KeyboardStyleSelectMsbIndex] << 8 | message[KeyboardStyleSelectMsbIndex + 1]);
+    }
+    else if (numMessageBytes == sizeof(KeyboardTempoSysExTemplate) && message[3] == 0x01)
+    {
+      const uint8_t* t = &message[KeyboardTempoFirstByteIndex];
+      uint32_t microsecondsPerQuarterNote = (uint32_t)t[0] << 21 | (uint32_t)t[1] << 14 | (uint32_t)t[2] << 7 | t[3];
+      state.tempo = (uint16_t)((60000000UL + microsecondsPerQuarterNote / 2) / microsecondsPerQuarterNote);
+    }
+    else if (numMessageBytes == sizeof(KeyboardSectionControlSysExTemplate) && message[3] == 0x00)
+    {
+      uint8_t switchNum = message[KeyboardSectionSwitchNumIndex];
+      if (message[KeyboardSectionSwitchNumIndex + 1] == 0x7F)
+      {
+        state.sectionSwitchNum = switchNum;
+        state.heldSwitches |= (uint64_t)1 << switchNum;
+      }
+      else
+      {
+        state.heldSwitches &= ~((uint64_t)1 << switchNum);
+      }
+    }
+    else
+    {
+      TEST_FAIL_MESSAGE("A message is not known.");
+    }
+
+    i = end + 1;
+  }
+
+  return state;
+}
+
+// A tempo change queued before a set list song is selected must not override the song's tempo.
+void TestSongBurstSupersedesQueuedTempo()
+{
+  PressPedal(StylePedal);
+  PressPedal(TempoUpPedal);
+  PressPedal(NextSongPedal);
+  DrainQueue();
+
+  KeyboardState state = GetKeyboardState();
+  TEST_ASSERT_EQUAL_HEX16(StyleNum::BigBandSwing, state.styleNum);
+  TEST_ASSERT_EQUAL_UINT16(132, state.tempo);
+  TEST_ASSERT_EQUAL_HEX8(StyleSectionControlSwitchNum::Intro1, state.sectionSwitchNum);
+  TEST_ASSERT_TRUE_MESSAGE(state.heldSwitches == 0, "A section switch is held on.");
+}
+
+// A Main section pressed after a set list song is selected must be sent after the song's burst.
+void TestMainSectionAfterSongBurstIsSentAfterIt()
+{
+  PressPedal(StylePedal);
+  PressPedal(NextSongPedal);
+  PressPedal(MainBPedal);
+  ReleasePedal(MainBPedal);
+  DrainQueue();
+
+  KeyboardState state = GetKeyboardState();
+  TEST_ASSERT_EQUAL_HEX16(StyleNum::BigBandSwing, state.styleNum);
+  TEST_ASSERT_EQUAL_UINT16(132, state.tempo);
+  TEST_ASSERT_EQUAL_HEX8(StyleSectionControlSwitchNum::MainB, state.sectionSwitchNum);
+  TEST_ASSERT_TRUE_MESSAGE(state.heldSwitches == 0, "A section switch is held on.");
+}
+
+// A Main section release must be sent if its press has started to be written, even when a newer Main section press supersedes the queued ones.
+void TestMainSectionOffIsSentAfterItsWrittenOn()
+{
+  // The UART has room for the first byte of Main A's press, which has then started to be written.
+  HostSerial().HostSetNumFreeBytes(1);
+  PressPedal(MainAPedal);
+  HostSerial().HostSetNumFreeBytes(0);
+  ReleasePedal(MainAPedal);
+  PressPedal(MainBPedal);
+  ReleasePedal(MainBPedal);
+  DrainQueue();
+
+  KeyboardState state = GetKeyboardState();
+  TEST_ASSERT_EQUAL_HEX8(StyleSectionControlSwitchNum::MainB, state.sectionSwitchNum);
+  TEST_ASSERT_TRUE_MESSAGE(state.heldSwitches == 0, "A section switch is held on.");
+  TEST_ASSERT_EQUAL_UINT16(0, gMidiTransmitQueue->GetNumCoalescedBytes(MidiMessagePriority::SectionMessagePriority));
+}
+
+// A queued Main section press and its release are both dropped when a newer Main section press supersedes them.
+void TestMainSectionOffIsDroppedWithItsOn()
+{
+  PressPedal(MainAPedal);
+  ReleasePedal(MainAPedal);
+  PressPedal(MainBPedal);
+  ReleasePedal(MainBPedal);
+  DrainQueue();
+
+  KeyboardState state = GetKeyboardState();
+  TEST_ASSERT_EQUAL_HEX8(StyleSectionControlSwitchNum::MainB, state.sectionSwitchNum);
+  TEST_ASSERT_TRUE_MESSAGE(state.heldSwitches == 0, "A section switch is held on.");
+  TEST_ASSERT_EQUAL_UINT16(2 * sizeof(KeyboardSectionControlSysExTemplate), gMidiTransmitQueue->GetNumCoalescedBytes(MidiMessagePriority::SectionMessagePriority));
+}
+
+// A Main section released after a newer press dropped its press is sent; the keyboard ignores the release of a switch that is not on.
+void TestMainSectionOffIsKeptWhenItsOnWasDroppedEarlier()
+{
+  PressPedal(MainAPedal);
+  PressPedal(MainBPedal);
+  ReleasePedal(MainAPedal);
+  ReleasePedal(MainBPedal);
+  DrainQueue();
+
+  KeyboardState state = GetKeyboardState();
+  TEST_ASSERT_EQUAL_HEX8(StyleSectionControlSwitchNum::MainB, state.sectionSwitchNum);
+  TEST_ASSERT_TRUE_MESSAGE(state.heldSwitches == 0, "A section switch is held on.");
+  TEST_ASSERT_EQUAL_UINT16(sizeof(KeyboardSectionControlSysExTemplate), gMidiTransmitQueue->GetNumCoalescedBytes(MidiMessagePriority::SectionMessagePriority));
+}
+
+// A set list song burst drops a queued Main section press with its release.
+void TestSongBurstDropsQueuedMainSectionOnAndOff()
+{
+  PressPedal(StylePedal);
+  PressPedal(MainAPedal);
+  ReleasePedal(MainAPedal);
+  PressPedal(NextSongPedal);
+  DrainQueue();
+
+  KeyboardState state = GetKeyboardState();
+  TEST_ASSERT_EQUAL_HEX8(StyleSectionControlSwitchNum::Intro1, state.sectionSwitchNum);
+  TEST_ASSERT_TRUE_MESSAGE(state.heldSwitches == 0, "A section switch is held on.");
+  TEST_ASSERT_EQUAL_UINT16(2 * sizeof(KeyboardSectionControlSysExTemplate), gMidiTransmitQueue->GetNumCoalescedBytes(MidiMessagePriority::SectionMessagePriority));
+}
+
+// A message is not started while the UART is full, so a Main section pressed after a tempo change is still sent first.
+void TestHigherClassIsSentFirstWhileUartIsFull()
+{
+  PressPedal(TempoUpPedal);
+  gMidiTransmitQueue->Update();
+  PressPedal(MainBPedal);
+  DrainQueue();
+
+  const std::vector<uint8_t>& bytes = HostSerial().HostWrittenBytes();
+  TEST_ASSERT_EQUAL_UINT32(sizeof(KeyboardSectionControlSysExTemplate) + sizeof(KeyboardTempoSysExTemplate), bytes.size());
+  TEST_ASSERT_EQUAL_HEX8(StyleSectionControlSwitchNum::MainB, bytes[KeyboardSectionSwitchNumIndex]);
+  TEST_ASSERT_EQUAL_UINT16(120, GetKeyboardState().tempo);
+}
+
+// Each set list song is sent as its style, its tempo, and a press and release of its starting section; the first song's burst
+// is precomputed in Setup(), and the next song's after each song is sent.
+void TestSongBurstBytes()
+{
+  const uint8_t firstSongBytes[] = {
+    0xF0, 0x43, 0x73, 0x01, 0x51, 0x05, 0x00, 0x03, 0x04, 0x00, 0x00, 0x1E, 0x52, 0xF7, // BigBandSwing.
+    0xF0, 0x43, 0x7E, 0x01, 0x00, 0x1B, 0x5F, 0x11, 0xF7,                               // 132 BPM; 454545 us per quarter note.
+    0xF0, 0x43, 0x7E, 0x00, 0x00, 0x7F, 0xF7,                                           // Intro 1 on.
+    0xF0, 0x43, 0x7E, 0x00, 0x00, 0x00, 0xF7                                            // Intro 1 off.
+  };
+
+  const uint8_t secondSongBytes[] = {
+    0xF0, 0x43, 0x73, 0x01, 0x51, 0x05, 0x00, 0x03, 0x04, 0x00, 0x00, 0x02, 0x73, 0xF7, // CoolBossa.
+    0xF0, 0x43, 0x7E, 0x01, 0x00, 0x21, 0x25, 0x2E, 0xF7,                               // 110 BPM; 545454 us per quarter note.
+    0xF0, 0x43, 0x7E, 0x00, 0x08, 0x7F, 0xF7,                                           // Main A on.
+    0xF0, 0x43, 0x7E, 0x00, 0x08, 0x00, 0xF7                                            // Main A off.
+  };
+
+  PressPedal(NextSongPedal);
+  DrainQueue();
+
+  const std::vector<uint8_t>& bytes = HostSerial().HostWrittenBytes();
+  TEST_ASSERT_EQUAL_UINT32(sizeof(firstSongBytes), bytes.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(firstSongBytes, bytes.data(), sizeof(firstSongBytes));
+
+  HostSerial().HostWrittenBytes().clear();
+  PressPedal(NextSongPedal);
+  DrainQueue();
+
+  TEST_ASSERT_EQUAL_UINT32(sizeof(secondSongBytes), bytes.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(secondSongBytes, bytes.data(), sizeof(secondSongBytes));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestSongBurstSupersedesQueuedTempo);
+  RUN_TEST(TestMainSectionAfterSongBurstIsSentAfterIt);
+  RUN_TEST(TestMainSectionOffIsSentAfterItsWrittenOn);
+  RUN_TEST(TestMainSectionOffIsDroppedWithItsOn);
+  RUN_TEST(TestMainSectionOffIsKeptWhenItsOnWasDroppedEarlier);
+  RUN_TEST(TestSongBurstDropsQueuedMainSectionOnAndOff);
+  RUN_TEST(TestHigherClassIsSentFirstWhileUartIsFull);
+  RUN_TEST(TestSongBurstBytes);
+  return UNITY_END();
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+// This file tests PedalConfigStore on the EEPROM stand-in: a saved configuration is loaded back, and a block with a wrong CRC,
+// a wrong version byte, or erased EEPROM, is not loaded.
+
+#include <unity.h>
+
+#include "PedalConfigStore.cpp"
+
+PedalConfig gPedalConfig;
+
+void setUp()
+{
+  memset(HostEeprom(), 0xFF, E2END + 1);
+
+  memset(&gPedalConfig, 0, sizeof(gPedalConfig));
+  gPedalConfig.pedalActions[0][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::SectionSwitchOn, 0x08);
+  gPedalConfig.pedalActions[0][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::SectionSwitchOff, 0x08);
+  gPedalConfig.pedalActions[1][PedalEdge::PressEdge] = MakeSelectStyleAction(0x1E52);
+  gPedalConfig.pedalActions[NumConfigurablePedals - 1][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::TempoUp);
+  gPedalConfig.defaultTempo = 120;
+  gPedalConfig.minTempo = 40;
+  gPedalConfig.maxTempo = 200;
+  gPedalConfig.debounceDelayMs = 20;
+}
+
+void tearDown()
+{
+}
+
+void TestSavedConfigIsLoaded()
+{
+  PedalConfigStore::Save(gPedalConfig);
+
+  PedalConfig loadedConfig;
+  memset(&loadedConfig, 0, sizeof(loadedConfig));
+  TEST_ASSERT_TRUE(PedalConfigStore::Load(loadedConfig));
+  TEST_ASSERT_EQUAL_MEMORY(&gPedalConfig, &loadedConfig, sizeof(PedalConfig));
+
+  TEST_ASSERT_EQUAL_HEX8(EepromPedalConfigVersion, HostEeprom()[EepromPedalConfigAddress]);
+}
+
+void TestErasedEepromIsNotLoaded()
+{
+  PedalConfig loadedConfig;
+  TEST_ASSERT_FALSE(PedalConfigStore::Load(loadedConfig));
+}
+
+// Every byte of the configuration and its CRC is covered; a changed byte fails to load, and the restored byte loads again.
+void TestCrcMismatchIsNotLoaded()
+{
+  PedalConfigStore::Save(gPedalConfig);
+
+  PedalConfig loadedConfig;
+  for (int address = EepromPedalConfigAddress + 1; address < EepromPedalConfigAddress + EepromPedalConfigSize; address++)
+  {
+    HostEeprom()[address] ^= 0x01;
+    TEST_ASSERT_FALSE_MESSAGE(PedalConfigStore::Load(loadedConfig), "A changed byte was loaded.");
+    HostEeprom()[address] ^= 0x01;
+  }
+
+  TEST_ASSERT_TRUE(PedalConfigStore::Load(loadedConfig));
+}
+
+void TestVersionMismatchIsNotLoaded()
+{
+  PedalConfigStore::Save(gPedalConfig);
+
+  PedalConfig loadedConfig;
+  HostEeprom()[EepromPedalConfigAddress] = EepromPedalConfigVersion - 1;
+  TEST_ASSERT_FALSE(PedalConfigStore::Load(loadedConfig));
+
+  // Saving again writes the current version.
+  PedalConfigStore::Save(gPedalConfig);
+  TEST_ASSERT_TRUE(PedalConfigStore::Load(loadedConfig));
+}
+
+// A block with a good CRC, and values outside the limits, is not loaded.
+void TestInvalidValuesAreNotLoaded()
+{
+  PedalConfig loadedConfig;
+
+  gPedalConfig.defaultTempo = gPedalConfig.maxTempo + 1;
+  PedalConfigStore::Save(gPedalConfig);
+  TEST_ASSERT_FALSE(PedalConfigStore::Load(loadedConfig));
+
+  gPedalConfig.defaultTempo = gPedalConfig.maxTempo;
+  gPedalConfig.debounceDelayMs = 0;
+  PedalConfigStore::Save(gPedalConfig);
+  TEST_ASSERT_FALSE(PedalConfigStore::Load(loadedConfig));
+
+  gPedalConfig.debounceDelayMs = 20;
+  gPedalConfig.pedalActions[2][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::NumPedalActionTypes);
+  PedalConfigStore::Save(gPedalConfig);
+  TEST_ASSERT_FALSE(PedalConfigStore::Load(loadedConfig));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestSavedConfigIsLoaded);
+  RUN_TEST(TestErasedEepromIsNotLoaded);
+  RUN_TEST(TestCrcMismatchIsNotLoaded);
+  RUN_TEST(TestVersionMismatchIsNotLoaded);
+  RUN_TEST(TestInvalidValuesAreNotLoaded);
+  return UNITY_END();
+}
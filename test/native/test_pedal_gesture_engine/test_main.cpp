@@ -0,0 +1,257 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests PedalGestureEngine's timer wheel: timeouts longer than one turn of the wheel, timers that wrap past its
+// last slot, timers sharing a slot, and the millis() rollover.
+
+#include <unity.h>
+
+#include "MidiAccompanimentController.h"
+
+#define DETECT_PEDAL_GESTURES
+
+#include "PedalGestureEngine.cpp"
+
+// The gesture handler forwards gestures to the Foot Pedal Switch Change Manager; this test records them instead.
+class FootPedalSwitchChangeManager {};
+
+static const uint8_t MaxRecordedGestures = 32;
+
+struct RecordedGesture
+{
+  byte buttonIndex;
+  PedalGesture gesture;
+  uint32_t elapsedTimeMs;
+};
+
+static RecordedGesture recordedGestures[MaxRecordedGestures];
+static uint8_t numRecordedGestures;
+static uint32_t startTimeMs;
+
+FootPedalGestureHandler::FootPedalGestureHandler(FootPedalSwitchChangeManager& footPedalSwitchChangeManager) :
+  mFootPedalSwitchChangeManager(footPedalSwitchChangeManager)
+{
+}
+
+void FootPedalGestureHandler::HandleGestureImpl(byte buttonIndex, PedalGesture gesture)
+{
+  TEST_ASSERT_TRUE(numRecordedGestures < MaxRecordedGestures);
+  recordedGestures[numRecordedGestures].buttonIndex = buttonIndex;
+  recordedGestures[numRecordedGestures].gesture = gesture;
+  recordedGestures[numRecordedGestures].elapsedTimeMs = (uint32_t)millis() - startTimeMs;
+  numRecordedGestures++;
+}
+
+static FootPedalSwitchChangeManager footPedalSwitchChangeManager;
+static FootPedalGestureHandler footPedalGestureHandler(footPedalSwitchChangeManager);
+
+// This function runs loop() once per millisecond for durationMs.
+static void RunFor(PedalGestureEngine& gestureEngine, uint32_t durationMs)
+{
+  for (uint32_t i = 0; i < durationMs; i++)
+  {
+    HostAdvanceMillis(1);
+    gestureEngine.Update();
+  }
+}
+
+static void CheckGesture(uint8_t recordIndex, byte buttonIndex, PedalGesture gesture, uint32_t elapsedTimeMs)
+{
+  TEST_ASSERT_TRUE(recordIndex < numRecordedGestures);
+  TEST_ASSERT_EQUAL_UINT8(buttonIndex, recordedGestures[recordIndex].buttonIndex);
+  TEST_ASSERT_EQUAL(gesture, recordedGestures[recordIndex].gesture);
+  TEST_ASSERT_EQUAL_UINT32(elapsedTimeMs, recordedGestures[recordIndex].elapsedTimeMs);
+}
+
+// This function checks a long press of pedal 0, pressed when the engine starts, held for three hold repeats, then released.
+// The long press timeout is longer than one turn of the wheel, and the hold repeats cross the wheel's last slot.
+static void CheckLongPress(uint32_t initialTimeMs)
+{
+  HostSetMillis(initialTimeMs);
+  startTimeMs = initialTimeMs;
+  PedalGestureEngine gestureEngine(footPedalGestureHandler);
+
+  gestureEngine.OnButtonChange(0, true);
+  RunFor(gestureEngine, LongPressMs + 3 * HoldRepeatMs);
+  gestureEngine.OnButtonChange(0, false);
+  RunFor(gestureEngine, LongPressMs);
+
+  TEST_ASSERT_EQUAL_UINT8(4, numRecordedGestures);
+  CheckGesture(0, 0, PedalGesture::LongPress, LongPressMs);
+  CheckGesture(1, 0, PedalGesture::Hold, LongPressMs + HoldRepeatMs);
+  CheckGesture(2, 0, PedalGesture::Hold, LongPressMs + 2 * HoldRepeatMs);
+  CheckGesture(3, 0, PedalGesture::Hold, LongPressMs + 3 * HoldRepeatMs);
+  TEST_ASSERT_TRUE(gestureEngine.IsIdle());
+}
+
+void setUp()
+{
+  numRecordedGestures = 0;
+}
+
+void tearDown()
+{
+}
+
+void TestLongPressWaitsExtraRounds()
+{
+  // The long press timeout is more than one turn of the wheel; the timer must not expire on the first pass of its slot.
+  TEST_ASSERT_TRUE(LongPressMs > NumGestureWheelSlots * GestureTickMs);
+  CheckLongPress(0);
+}
+
+void TestTimersWrapPastTheLastSlot()
+{
+  HostSetMillis(0);
+  startTimeMs = 0;
+  PedalGestureEngine gestureEngine(footPedalGestureHandler);
+
+  // Start the timers two ticks before the wheel's last slot, so they wrap to its first slots.
+  RunFor(gestureEngine, (NumGestureWheelSlots - 2) * GestureTickMs);
+  startTimeMs = millis();
+
+  gestureEngine.OnButtonChange(1, true);
+  gestureEngine.OnButtonChange(1, false);
+  RunFor(gestureEngine, DoubleTapWindowMs - 1);
+  TEST_ASSERT_EQUAL_UINT8(0, numRecordedGestures);
+
+  RunFor(gestureEngine, 1);
+  TEST_ASSERT_EQUAL_UINT8(1, numRecordedGestures);
+  CheckGesture(0, 1, PedalGesture::Tap, DoubleTapWindowMs);
+  TEST_ASSERT_TRUE(gestureEngine.IsIdle());
+}
+
+void TestCancelledTimerLeavesItsSlotIntact()
+{
+  HostSetMillis(0);
+  startTimeMs = 0;
+  PedalGestureEngine gestureEngine(footPedalGestureHandler);
+
+  // Three pedals are pressed together, so their timers share a slot; the middle one of the slot's list is released early.
+  gestureEngine.OnButtonChange(2, true);
+  gestureEngine.OnButtonChange(3, true);
+  gestureEngine.OnButtonChange(4, true);
+  RunFor(gestureEngine, GestureTickMs);
+  gestureEngine.OnButtonChange(3, false);
+  gestureEngine.OnButtonChange(3, true);
+
+  RunFor(gestureEngine, LongPressMs - GestureTickMs);
+  gestureEngine.OnButtonChange(2, false);
+  gestureEngine.OnButtonChange(3, false);
+  gestureEngine.OnButtonChange(4, false);
+  RunFor(gestureEngine, LongPressMs);
+
+  TEST_ASSERT_EQUAL_UINT8(3, numRecordedGestures);
+  CheckGesture(0, 3, PedalGesture::DoubleTap, GestureTickMs);
+  CheckGesture(1, 4, PedalGesture::LongPress, LongPressMs);
+  CheckGesture(2, 2, PedalGesture::LongPress, LongPressMs);
+  TEST_ASSERT_TRUE(gestureEngine.IsIdle());
+}
+
+void TestLongPressAcrossMillisRollover()
+{
+  // The long press and its hold repeats end after millis() rolls over to 0.
+  CheckLongPress(0xFFFFFFFF - LongPressMs / 2);
+}
+
+void TestTapAcrossMillisRollover()
+{
+  const uint32_t InitialTimeMs = 0xFFFFFFFF - GestureTickMs - 1;
+  HostSetMillis(InitialTimeMs);
+  startTimeMs = InitialTimeMs;
+  PedalGestureEngine gestureEngine(footPedalGestureHandler);
+
+  gestureEngine.OnButtonChange(5, true);
+  gestureEngine.OnButtonChange(5, false);
+  RunFor(gestureEngine, DoubleTapWindowMs + 2 * GestureTickMs);
+
+  TEST_ASSERT_EQUAL_UINT8(1, numRecordedGestures);
+  CheckGesture(0, 5, PedalGesture::Tap, DoubleTapWindowMs);
+  TEST_ASSERT_TRUE(millis() < InitialTimeMs);
+}
+
+// The pedals of a combo are cancelled when the combo is sent; they send no long press or hold repeats while held,
+// and no tap when released, but their next press starts a new gesture.
+void TestCancelledPedalsSendNoGestures()
+{
+  HostSetMillis(0);
+  startTimeMs = 0;
+  PedalGestureEngine gestureEngine(footPedalGestureHandler);
+
+  gestureEngine.OnButtonChange(3, true);
+  RunFor(gestureEngine, 2 * GestureTickMs);
+  gestureEngine.OnButtonChange(7, true);
+  gestureEngine.CancelPedal(3);
+  gestureEngine.CancelPedal(7);
+  TEST_ASSERT_TRUE(gestureEngine.IsIdle());
+
+  RunFor(gestureEngine, LongPressMs + 3 * HoldRepeatMs);
+  gestureEngine.OnButtonChange(3, false);
+  gestureEngine.OnButtonChange(7, false);
+  RunFor(gestureEngine, DoubleTapWindowMs + GestureTickMs);
+  TEST_ASSERT_EQUAL_UINT8(0, numRecordedGestures);
+  TEST_ASSERT_TRUE(gestureEngine.IsIdle());
+
+  startTimeMs = millis();
+  gestureEngine.OnButtonChange(3, true);
+  gestureEngine.OnButtonChange(3, false);
+  RunFor(gestureEngine, DoubleTapWindowMs);
+  TEST_ASSERT_EQUAL_UINT8(1, numRecordedGestures);
+  CheckGesture(0, 3, PedalGesture::Tap, DoubleTapWindowMs);
+}
+
+// A pedal cancelled while it sends hold repeats stops sending them.
+void TestCancelledPedalStopsHoldRepeats()
+{
+  HostSetMillis(0);
+  startTimeMs = 0;
+  PedalGestureEngine gestureEngine(footPedalGestureHandler);
+
+  gestureEngine.OnButtonChange(5, true);
+  RunFor(gestureEngine, LongPressMs + HoldRepeatMs);
+  gestureEngine.CancelPedal(5);
+  RunFor(gestureEngine, 3 * HoldRepeatMs);
+  gestureEngine.OnButtonChange(5, false);
+  RunFor(gestureEngine, DoubleTapWindowMs + GestureTickMs);
+
+  TEST_ASSERT_EQUAL_UINT8(2, numRecordedGestures);
+  CheckGesture(0, 5, PedalGesture::LongPress, LongPressMs);
+  CheckGesture(1, 5, PedalGesture::Hold, LongPressMs + HoldRepeatMs);
+  TEST_ASSERT_TRUE(gestureEngine.IsIdle());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestLongPressWaitsExtraRounds);
+  RUN_TEST(TestTimersWrapPastTheLastSlot);
+  RUN_TEST(TestCancelledTimerLeavesItsSlotIntact);
+  RUN_TEST(TestLongPressAcrossMillisRollover);
+  RUN_TEST(TestTapAcrossMillisRollover);
+  RUN_TEST(TestCancelledPedalsSendNoGestures);
+  RUN_TEST(TestCancelledPedalStopsHoldRepeats);
+  return UNITY_END();
+}
@@ -0,0 +1,252 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+
+// This file tests the pedal link from PedalLinkSender to PedalLinkReceiver: the sender's frames are looped back to the receiver,
+// or dropped or corrupted on the way, and the receiver's bitmap, lost frame and frame error counts are checked.
+
+#include <unity.h>
+
+#include "MidiAccompanimentController.h"
+
+// The sender and the receiver run on different boards, so the directives do not allow both; the sender is built first,
+// so the shared constants are the remote board's, which has no remote pedals of its own.
+#define SEND_PEDAL_LINK
+#include "PedalLink/PedalLinkSender.cpp"
+
+#undef SEND_PEDAL_LINK
+#define RECEIVE_PEDAL_LINK
+#include "PedalLink/PedalLinkReceiver.cpp"
+
+PedalLinkSender* gPedalLinkSender;
+PedalLinkReceiver* gPedalLinkReceiver;
+
+// This function discards the bytes written and not yet read by the previous test.
+void ClearSerial()
+{
+  HostSerial().HostWrittenBytes().clear();
+  while (Serial.read() >= 0)
+  {
+  }
+}
+
+void setUp()
+{
+  HostSetMillis(1000);
+  ClearSerial();
+
+  gPedalLinkSender = new PedalLinkSender();
+  gPedalLinkReceiver = new PedalLinkReceiver();
+}
+
+void tearDown()
+{
+  delete gPedalLinkReceiver;
+  delete gPedalLinkSender;
+}
+
+// This function updates the sender, and returns the bytes it sent.
+std::vector<uint8_t> SendFrames()
+{
+  gPedalLinkSender->Update();
+  std::vector<uint8_t> sentBytes = HostSerial().HostWrittenBytes();
+  HostSerial().HostWrittenBytes().clear();
+  return sentBytes;
+}
+
+// This function passes the bytes to the receiver, and returns true if it received a bitmap frame.
+bool ReceiveFrames(const std::vector<uint8_t>& bytes)
+{
+  HostSerial().HostReceiveBytes(bytes);
+  return gPedalLinkReceiver->Update();
+}
+
+// This function returns the remote pedal bitmap the receiver holds.
+PedalFlags GetReceivedFlags()
+{
+  PedalFlags pressedFlags = 0;
+  for (uint8_t i = NumPedalLinkBitmapBytes; i > 0; i--)
+  {
+    pressedFlags = (pressedFlags << 7) | gPedalLinkReceiver->GetBitmapByte(i - 1);
+  }
+
+  return pressedFlags;
+}
+
+void TestPressedPedalsReachTheReceiver()
+{
+  gPedalLinkSender->SetPedal(0, true);
+  gPedalLinkSender->SetPedal(NumLinkedPedals - 1, true);
+
+  std::vector<uint8_t> sentBytes = SendFrames();
+  TEST_ASSERT_EQUAL(NumPedalLinkFrameBytes + 2, sentBytes.size());
+  TEST_ASSERT_TRUE(ReceiveFrames(sentBytes));
+
+  TEST_ASSERT_EQUAL_HEX32(1 | ((PedalFlags)1 << (NumLinkedPedals - 1)), GetReceivedFlags());
+  TEST_ASSERT_FALSE(gPedalLinkReceiver->IsTimedOut());
+  TEST_ASSERT_EQUAL(0, gPedalLinkReceiver->GetNumFrameErrors());
+  TEST_ASSERT_EQUAL(0, gPedalLinkReceiver->GetNumLostFrames());
+
+  gPedalLinkSender->SetPedal(0, false);
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+  TEST_ASSERT_EQUAL_HEX32((PedalFlags)1 << (NumLinkedPedals - 1), GetReceivedFlags());
+}
+
+void TestUnchangedBitmapIsRefreshed()
+{
+  gPedalLinkSender->SetPedal(2, true);
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+
+  HostAdvanceMillis(PedalLinkRefreshMs - 1);
+  TEST_ASSERT_EQUAL(0, SendFrames().size());
+
+  HostAdvanceMillis(1);
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+  TEST_ASSERT_EQUAL_HEX32(1 << 2, GetReceivedFlags());
+  TEST_ASSERT_EQUAL(0, gPedalLinkReceiver->GetNumLostFrames());
+}
+
+void TestReceiverTimesOutWithoutFrames()
+{
+  TEST_ASSERT_TRUE(gPedalLinkReceiver->IsTimedOut());
+
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+  HostAdvanceMillis(PedalLinkTimeoutMs - 1);
+  TEST_ASSERT_FALSE(gPedalLinkReceiver->IsTimedOut());
+
+  HostAdvanceMillis(1);
+  TEST_ASSERT_TRUE(gPedalLinkReceiver->IsTimedOut());
+}
+
+void TestDroppedFramesAreCountedAsLost()
+{
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+
+  // Three changes are sent, but only the last frame reaches the receiver.
+  for (uint8_t i = 1; i <= 3; i++)
+  {
+    gPedalLinkSender->SetPedal(i, true);
+    std::vector<uint8_t> sentBytes = SendFrames();
+    if (i == 3)
+    {
+      TEST_ASSERT_TRUE(ReceiveFrames(sentBytes));
+    }
+  }
+
+  TEST_ASSERT_EQUAL(2, gPedalLinkReceiver->GetNumLostFrames());
+  TEST_ASSERT_EQUAL(0, gPedalLinkReceiver->GetNumFrameErrors());
+  TEST_ASSERT_EQUAL_HEX32(0x0E, GetReceivedFlags());
+}
+
+void TestSequenceNumberWrapIsNotCountedAsLost()
+{
+  // 300 frames, past the 7-bit sequence number's wrap twice, all received.
+  for (uint16_t i = 0; i < 300; i++)
+  {
+    gPedalLinkSender->SetPedal(0, (i & 1) != 0);
+    TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+  }
+
+  TEST_ASSERT_EQUAL(0, gPedalLinkReceiver->GetNumLostFrames());
+
+  // Frames 300 to 303 are dropped; the sequence numbers received are 43 and 48.
+  for (uint16_t i = 300; i < 305; i++)
+  {
+    gPedalLinkSender->SetPedal(0, (i & 1) != 0);
+    std::vector<uint8_t> sentBytes = SendFrames();
+    if (i == 304)
+    {
+      TEST_ASSERT_TRUE(ReceiveFrames(sentBytes));
+    }
+  }
+
+  TEST_ASSERT_EQUAL(4, gPedalLinkReceiver->GetNumLostFrames());
+}
+
+void TestLostFramesAcrossTheWrapAreCounted()
+{
+  // Frames 0 to 125 are received; frames 126 to 129, with sequence numbers 126, 127, 0 and 1, are dropped.
+  for (uint16_t i = 0; i < 131; i++)
+  {
+    gPedalLinkSender->SetPedal(0, (i & 1) != 0);
+    std::vector<uint8_t> sentBytes = SendFrames();
+    if (i < 126 || i == 130)
+    {
+      TEST_ASSERT_TRUE(ReceiveFrames(sentBytes));
+    }
+  }
+
+  TEST_ASSERT_EQUAL(4, gPedalLinkReceiver->GetNumLostFrames());
+}
+
+void TestCorruptFrameIsCountedAsError()
+{
+  gPedalLinkSender->SetPedal(1, true);
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+
+  // A bitmap bit is flipped on the way; the CRC does not match, and the previous bitmap is kept.
+  gPedalLinkSender->SetPedal(4, true);
+  std::vector<uint8_t> sentBytes = SendFrames();
+  sentBytes[4] ^= 0x01;
+  TEST_ASSERT_FALSE(ReceiveFrames(sentBytes));
+
+  TEST_ASSERT_EQUAL(1, gPedalLinkReceiver->GetNumFrameErrors());
+  TEST_ASSERT_EQUAL_HEX32(1 << 1, GetReceivedFlags());
+
+  // The next frame is received, and the corrupt frame is also counted as lost.
+  gPedalLinkSender->SetPedal(5, true);
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+  TEST_ASSERT_EQUAL_HEX32((1 << 1) | (1 << 4) | (1 << 5), GetReceivedFlags());
+  TEST_ASSERT_EQUAL(1, gPedalLinkReceiver->GetNumLostFrames());
+}
+
+void TestTruncatedFrameIsCountedAsError()
+{
+  // The end of a frame is lost, and the next frame's start byte restarts the parser.
+  std::vector<uint8_t> sentBytes = SendFrames();
+  sentBytes.resize(sentBytes.size() - 3);
+  TEST_ASSERT_FALSE(ReceiveFrames(sentBytes));
+
+  gPedalLinkSender->SetPedal(6, true);
+  TEST_ASSERT_TRUE(ReceiveFrames(SendFrames()));
+
+  TEST_ASSERT_EQUAL(1, gPedalLinkReceiver->GetNumFrameErrors());
+  TEST_ASSERT_EQUAL_HEX32(1 << 6, GetReceivedFlags());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestPressedPedalsReachTheReceiver);
+  RUN_TEST(TestUnchangedBitmapIsRefreshed);
+  RUN_TEST(TestReceiverTimesOutWithoutFrames);
+  RUN_TEST(TestDroppedFramesAreCountedAsLost);
+  RUN_TEST(TestSequenceNumberWrapIsNotCountedAsLost);
+  RUN_TEST(TestLostFramesAcrossTheWrapAreCounted);
+  RUN_TEST(TestCorruptFrameIsCountedAsError);
+  RUN_TEST(TestTruncatedFrameIsCountedAsError);
+  return UNITY_END();
+}
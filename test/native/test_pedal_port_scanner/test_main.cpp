@@ -0,0 +1,132 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests PedalPortScanner's and PedalPinMap's mapping of the input port bits to the pedal flags, on the host's simulated ports.
+
+#include <unity.h>
+
+#include "PedalBoards.cpp"
+#include "PedalInputs/PedalPinMap.h"
+#include "PedalInputs/PedalPortScanner.cpp"
+
+// The pin of each button index, from the pedal boards in PedalBoards.h; the eight-pedal board's last two pedals are wired in swapped order.
+static const uint8_t ExpectedButtonPins[] = {2, 3, 4, 5, 6, 12, A0, A2, 11, A1, 8, 9, 10};
+
+static_assert(sizeof(ExpectedButtonPins) == NumDigitalPedals, "ExpectedButtonPins does not match the pedal boards.");
+
+static Button buttons[NumFootPedalButtons];
+static PedalPortScanner pedalPortScanner;
+
+void setUp()
+{
+  memset(buttons, 0, sizeof(buttons));
+  SetupPedalBoardButtons(buttons);
+  pedalPortScanner.Setup(buttons, NumDigitalPedals);
+
+  // The pedal pins are pulled up; no pedal is pressed.
+  PINB = 0xFF;
+  PINC = 0xFF;
+  PIND = 0xFF;
+}
+
+void tearDown()
+{
+}
+
+void TestNoPedalPressed()
+{
+  TEST_ASSERT_EQUAL_HEX16(0, pedalPortScanner.ReadPressedFlags());
+}
+
+void TestEachPedalPinSetsItsButtonFlag()
+{
+  for (uint8_t i = 0; i < NumDigitalPedals; i++)
+  {
+    HostSetPinLevel(ExpectedButtonPins[i], LOW);
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE(1 << i, pedalPortScanner.ReadPressedFlags(), "A pressed pedal's pin did not set its button flag.");
+    HostSetPinLevel(ExpectedButtonPins[i], HIGH);
+  }
+}
+
+void TestAllPedalsPressed()
+{
+  for (uint8_t i = 0; i < NumDigitalPedals; i++)
+  {
+    HostSetPinLevel(ExpectedButtonPins[i], LOW);
+  }
+
+  TEST_ASSERT_EQUAL_HEX16((1 << NumDigitalPedals) - 1, pedalPortScanner.ReadPressedFlags());
+}
+
+void TestOtherPinsAreIgnored()
+{
+  // The UART pins, pin 7, the LED pin and the spare analog pins.
+  const uint8_t otherPins[] = {0, 1, 7, 13, A3, A4, A5};
+  for (uint8_t i = 0; i < sizeof(otherPins); i++)
+  {
+    HostSetPinLevel(otherPins[i], LOW);
+  }
+
+  TEST_ASSERT_EQUAL_HEX16(0, pedalPortScanner.ReadPressedFlags());
+}
+
+void TestPortSnapshotMapsToFlags()
+{
+  // Pin 12 (PB4), pin A1 (PC1) and pin 2 (PD2) are low.
+  uint8_t portSnapshot[PedalPortScanner::NumPorts];
+  portSnapshot[PedalPortScanner::PortB] = (uint8_t)~(1 << 4);
+  portSnapshot[PedalPortScanner::PortC] = (uint8_t)~(1 << 1);
+  portSnapshot[PedalPortScanner::PortD] = (uint8_t)~(1 << 2);
+
+  TEST_ASSERT_EQUAL_HEX16((1 << 5) | (1 << 9) | (1 << 0), pedalPortScanner.GetPressedFlags(portSnapshot));
+}
+
+void TestStaticPinMapMatchesPortScanner()
+{
+  for (uint8_t i = 0; i < NumDigitalPedals; i++)
+  {
+    HostSetPinLevel(ExpectedButtonPins[i], LOW);
+    TEST_ASSERT_EQUAL_HEX16(1 << i, BoardPedalPinMap::ReadPressedFlags());
+    HostSetPinLevel(ExpectedButtonPins[i], HIGH);
+  }
+
+  HostSetPinLevel(ExpectedButtonPins[0], LOW);
+  HostSetPinLevel(ExpectedButtonPins[7], LOW);
+  HostSetPinLevel(ExpectedButtonPins[12], LOW);
+  TEST_ASSERT_EQUAL_HEX16(pedalPortScanner.ReadPressedFlags(), BoardPedalPinMap::ReadPressedFlags());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestNoPedalPressed);
+  RUN_TEST(TestEachPedalPinSetsItsButtonFlag);
+  RUN_TEST(TestAllPedalsPressed);
+  RUN_TEST(TestOtherPinsAreIgnored);
+  RUN_TEST(TestPortSnapshotMapsToFlags);
+  RUN_TEST(TestStaticPinMapMatchesPortScanner);
+  return UNITY_END();
+}
@@ -0,0 +1,198 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests PerformanceJournal on the EEPROM stand-in: the latest record is restored across the sequence number's wrap,
+// a partly written record falls back to the previous record, and the records are spread across all the slots.
+
+#include <unity.h>
+
+#include "PerformanceJournal.cpp"
+
+// The EEPROM bytes of a journal record: the performance state, the sequence number and the CRC.
+const uint8_t RecordSize = EepromPerformanceJournalRecordSize;
+const uint8_t SequenceNumberOffset = sizeof(PerformanceState);
+
+void setUp()
+{
+  memset(HostEeprom(), 0xFF, E2END + 1);
+  memset(HostEepromWriteCounts(), 0, (E2END + 1) * sizeof(uint32_t));
+  HostSetMillis(1000);
+}
+
+void tearDown()
+{
+}
+
+// This function returns a performance state that differs from those of the numbers next to it.
+PerformanceState GetTestState(uint16_t stateNum)
+{
+  return PerformanceState{(uint16_t)(0x1000 + stateNum), (uint8_t)(30 + stateNum % 200), (uint8_t)(0x08 + stateNum % 4)};
+}
+
+// This function changes the state, and updates the journal until its record is written.
+void RecordState(PerformanceJournal& journal, const PerformanceState& state)
+{
+  journal.Update(state);
+  HostAdvanceMillis(PerformanceJournalSaveDelayMs);
+  while (!journal.IsIdle())
+  {
+    journal.Update(state);
+  }
+}
+
+// This function returns the state restored after a power cycle.
+PerformanceState RestoreState(bool expectedIsFound = true)
+{
+  PerformanceJournal journal;
+  PerformanceState state;
+  TEST_ASSERT_EQUAL(expectedIsFound, journal.Setup(state));
+  return state;
+}
+
+void AssertStatesEqual(const PerformanceState& expectedState, const PerformanceState& state)
+{
+  TEST_ASSERT_EQUAL_HEX16(expectedState.styleNum, state.styleNum);
+  TEST_ASSERT_EQUAL_UINT8(expectedState.tempo, state.tempo);
+  TEST_ASSERT_EQUAL_HEX8(expectedState.sectionSwitchNum, state.sectionSwitchNum);
+}
+
+void TestEmptyJournalRestoresNothing()
+{
+  AssertStatesEqual(UnknownPerformanceState, RestoreState(false));
+}
+
+// The latest record is restored as the sequence number passes 127, where its signed difference wraps, and 255, where it wraps.
+void TestLatestRecordIsRestoredAcrossSequenceNumberWrap()
+{
+  PerformanceJournal journal;
+  PerformanceState state;
+  journal.Setup(state);
+
+  for (uint16_t stateNum = 1; stateNum <= 300; stateNum++)
+  {
+    RecordState(journal, GetTestState(stateNum));
+    AssertStatesEqual(GetTestState(stateNum), RestoreState());
+  }
+}
+
+// A journal restored from EEPROM continues after its latest record.
+void TestRestoredJournalContinues()
+{
+  for (uint16_t stateNum = 1; stateNum <= 100; stateNum++)
+  {
+    PerformanceJournal journal;
+    PerformanceState state;
+    journal.Setup(state);
+    RecordState(journal, GetTestState(stateNum));
+  }
+
+  AssertStatesEqual(GetTestState(100), RestoreState());
+}
+
+// A record cut short by a reset, before its CRC is written, fails its CRC; the previous record is restored.
+void TestPartialRecordFallsBackToPreviousRecord()
+{
+  PerformanceJournal journal;
+  PerformanceState state;
+  journal.Setup(state);
+
+  // The second partial record is written over an older record, once the slots have been used.
+  for (uint16_t stateNum = 1; stateNum <= 40; stateNum++)
+  {
+    RecordState(journal, GetTestState(stateNum));
+
+    if (stateNum == 1 || stateNum == 40)
+    {
+      PerformanceJournal interruptedJournal;
+      interruptedJournal.Setup(state);
+
+      // The first call begins the record; each later call writes one byte. The CRC is not written.
+      interruptedJournal.Update(GetTestState(1000));
+      HostAdvanceMillis(PerformanceJournalSaveDelayMs);
+      for (uint8_t i = 0; i < RecordSize; i++)
+      {
+        interruptedJournal.Update(GetTestState(1000));
+      }
+
+      TEST_ASSERT_FALSE(interruptedJournal.IsIdle());
+      AssertStatesEqual(GetTestState(stateNum), RestoreState());
+    }
+  }
+}
+
+// Each record is written to the next slot, so after two records per slot every slot's cells were written twice.
+void TestWritesAreSpreadAcrossSlots()
+{
+  PerformanceJournal journal;
+  PerformanceState state;
+  journal.Setup(state);
+
+  for (uint16_t stateNum = 1; stateNum <= 2 * NumPerformanceJournalRecords; stateNum++)
+  {
+    RecordState(journal, GetTestState(stateNum));
+  }
+
+  for (uint8_t slot = 0; slot < NumPerformanceJournalRecords; slot++)
+  {
+    int address = EepromPerformanceJournalAddress + slot * RecordSize;
+    TEST_ASSERT_EQUAL_UINT32(2, HostEepromWriteCounts()[address + SequenceNumberOffset]);
+    for (uint8_t i = 0; i < RecordSize; i++)
+    {
+      TEST_ASSERT_TRUE(HostEepromWriteCounts()[address + i] <= 2);
+    }
+  }
+}
+
+// A run of changes within the save delay is written once.
+void TestRunOfChangesIsWrittenOnce()
+{
+  PerformanceJournal journal;
+  PerformanceState state;
+  journal.Setup(state);
+
+  for (uint16_t stateNum = 1; stateNum <= 10; stateNum++)
+  {
+    journal.Update(GetTestState(stateNum));
+    HostAdvanceMillis(PerformanceJournalSaveDelayMs / 2);
+  }
+
+  RecordState(journal, GetTestState(10));
+  TEST_ASSERT_EQUAL_UINT32(1, HostEepromWriteCounts()[EepromPerformanceJournalAddress + SequenceNumberOffset]);
+  TEST_ASSERT_EQUAL_UINT32(0, HostEepromWriteCounts()[EepromPerformanceJournalAddress + RecordSize + SequenceNumberOffset]);
+  AssertStatesEqual(GetTestState(10), RestoreState());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestEmptyJournalRestoresNothing);
+  RUN_TEST(TestLatestRecordIsRestoredAcrossSequenceNumberWrap);
+  RUN_TEST(TestRestoredJournalContinues);
+  RUN_TEST(TestPartialRecordFallsBackToPreviousRecord);
+  RUN_TEST(TestWritesAreSpreadAcrossSlots);
+  RUN_TEST(TestRunOfChangesIsWrittenOnce);
+  return UNITY_END();
+}
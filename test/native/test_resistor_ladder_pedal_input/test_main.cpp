@@ -0,0 +1,214 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests the resistor ladder decoding with synthetic noisy ladder voltages, and the free-running ADC's
+// assignment of samples to channels, with a simulated ADC.
+
+#include <unity.h>
+
+#define READ_LADDER_PEDALS
+#define READ_EXPRESSION_PEDAL
+
+#include "PedalInputs/FreeRunningAdc.cpp"
+#include "PedalInputs/ResistorLadderPedalInput.cpp"
+
+FreeRunningAdc gFreeRunningAdc;
+
+// The ladder level of the pressed flags, in ADC counts.
+static uint16_t GetLadderLevel(uint8_t pressedFlags)
+{
+  return pressedFlags * LadderStep;
+}
+
+// This function returns pseudo-random noise from -amplitude to amplitude; the sequence is the same on every run.
+static int16_t GetNoise(int16_t amplitude)
+{
+  static uint32_t noiseState = 12345;
+  noiseState = noiseState * 1103515245 + 12345;
+  return (int16_t)((noiseState >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+static uint16_t GetNoisySample(uint16_t level, int16_t noiseAmplitude)
+{
+  int16_t sample = (int16_t)level + GetNoise(noiseAmplitude);
+  return sample < 0 ? 0 : (sample > 1023 ? 1023 : sample);
+}
+
+// The simulated ADC's input voltages, in ADC counts, of A0..A5, and the input of the conversion in progress.
+static uint16_t adcInputs[6];
+static uint8_t convertingInput;
+
+// This function completes the conversion in progress, as the ADC does in free-running mode: the next conversion starts
+// at once, with the input selected then, and the ISR runs after it has started.
+static void CompleteConversion()
+{
+  uint16_t sample = adcInputs[convertingInput];
+  convertingInput = ADMUX & 0x07;
+  ADC = sample;
+  ADC_vect();
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void TestEveryLevelIsClassifiedDespiteNoise()
+{
+  ResistorLadderPedalInput ladderPedalInput;
+  // The largest noise that never reaches the hold band of an adjacent level.
+  const int16_t NoiseAmplitude = LadderStep / 2 - LadderHysteresis - 1;
+
+  for (uint8_t pressedFlags = 0; pressedFlags <= MaxLadderFlags; pressedFlags++)
+  {
+    for (uint8_t i = 0; i < 100; i++)
+    {
+      uint8_t classifiedFlags = ladderPedalInput.ClassifySample(GetNoisySample(GetLadderLevel(pressedFlags), NoiseAmplitude));
+
+      // The flags change only after LadderStableSamples samples at the new level, and never to another level.
+      if (i >= LadderStableSamples - 1)
+      {
+        TEST_ASSERT_EQUAL_UINT8(pressedFlags, classifiedFlags);
+      }
+      else
+      {
+        TEST_ASSERT_TRUE(classifiedFlags == pressedFlags || classifiedFlags == pressedFlags - 1);
+      }
+    }
+  }
+}
+
+void TestFlagsChangeAfterStableSamples()
+{
+  ResistorLadderPedalInput ladderPedalInput;
+
+  for (uint8_t i = 0; i < LadderStableSamples - 1; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(0, ladderPedalInput.ClassifySample(GetLadderLevel(5)));
+  }
+
+  TEST_ASSERT_EQUAL_UINT8(5, ladderPedalInput.ClassifySample(GetLadderLevel(5)));
+}
+
+void TestTransitionLevelsAreRejected()
+{
+  ResistorLadderPedalInput ladderPedalInput;
+
+  // Pedals 0 and 3 are pressed together; their switches close a few samples apart, so the ladder passes through pedal 3's level.
+  const uint16_t samples[] = {GetLadderLevel(8), GetLadderLevel(8), GetLadderLevel(9), GetLadderLevel(9), GetLadderLevel(9), GetLadderLevel(9)};
+  const uint8_t expectedFlags[] = {0, 0, 0, 0, 0, 9};
+
+  for (uint8_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(expectedFlags[i], ladderPedalInput.ClassifySample(samples[i]));
+  }
+}
+
+void TestHysteresisHoldsTheLevelNearABandEdge()
+{
+  ResistorLadderPedalInput ladderPedalInput;
+  const uint16_t BandEdge = LadderStep / 2;
+
+  // Samples past the band edge, but within the hysteresis, do not leave level 0.
+  for (uint8_t i = 0; i < 20; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(0, ladderPedalInput.ClassifySample(BandEdge + LadderHysteresis));
+  }
+
+  for (uint8_t i = 0; i < LadderStableSamples; i++)
+  {
+    ladderPedalInput.ClassifySample(BandEdge + LadderHysteresis + 1);
+  }
+
+  TEST_ASSERT_EQUAL_UINT8(1, ladderPedalInput.ClassifySample(BandEdge + LadderHysteresis + 1));
+
+  // Level 1 holds from the other side of the same edge.
+  for (uint8_t i = 0; i < 20; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(1, ladderPedalInput.ClassifySample(BandEdge - LadderHysteresis));
+  }
+}
+
+void TestFullScaleIsTheLastLevel()
+{
+  ResistorLadderPedalInput ladderPedalInput;
+
+  for (uint8_t i = 0; i < LadderStableSamples; i++)
+  {
+    ladderPedalInput.ClassifySample(1023);
+  }
+
+  TEST_ASSERT_EQUAL_UINT8(MaxLadderFlags, ladderPedalInput.ClassifySample(1023));
+}
+
+void TestAdcSamplesReachTheirChannels()
+{
+  ResistorLadderPedalInput ladderPedalInput;
+  ladderPedalInput.Setup(gFreeRunningAdc);
+  uint8_t expressionChannel = gFreeRunningAdc.AddChannel(A4);
+  gFreeRunningAdc.Start();
+  convertingInput = ADMUX & 0x07;
+
+  adcInputs[LadderPedalPin - A0] = GetLadderLevel(6);
+  adcInputs[A4 - A0] = 700;
+
+  // The channels are sampled in turn; each stored sample is from its own pin.
+  for (uint8_t i = 0; i < 4 * LadderStableSamples; i++)
+  {
+    CompleteConversion();
+    uint16_t ladderSample = gFreeRunningAdc.GetSample(0);
+    uint16_t expressionSample = gFreeRunningAdc.GetSample(expressionChannel);
+    TEST_ASSERT_TRUE(ladderSample == 0 || ladderSample == GetLadderLevel(6));
+    TEST_ASSERT_TRUE(expressionSample == 0 || expressionSample == 700);
+    ladderPedalInput.ReadPressedFlags();
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(GetLadderLevel(6), gFreeRunningAdc.GetSample(0));
+  TEST_ASSERT_EQUAL_UINT16(700, gFreeRunningAdc.GetSample(expressionChannel));
+  TEST_ASSERT_EQUAL_UINT8(6, ladderPedalInput.ReadPressedFlags());
+
+  // A ladder sample is classified once; without a new sample, ReadPressedFlags() does not count it again.
+  adcInputs[LadderPedalPin - A0] = GetLadderLevel(2);
+  for (uint8_t i = 0; i < LadderStableSamples; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(6, ladderPedalInput.ReadPressedFlags());
+  }
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestEveryLevelIsClassifiedDespiteNoise);
+  RUN_TEST(TestFlagsChangeAfterStableSamples);
+  RUN_TEST(TestTransitionLevelsAreRejected);
+  RUN_TEST(TestHysteresisHoldsTheLevelNearABandEdge);
+  RUN_TEST(TestFullScaleIsTheLastLevel);
+  RUN_TEST(TestAdcSamplesReachTheirChannels);
+  return UNITY_END();
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests ShiftRegisterPedalInput against a simulated chain of NumPedalShiftRegisters 74HC165 shift registers:
+// the bit order, the inversion of the pulled-up inputs, and the number of bytes read per scan.
+
+#include <unity.h>
+
+// The default build's directives are checked first; the shift registers then replace the port scan.
+#include "MidiAccompanimentController.h"
+#undef SCAN_PEDAL_PORTS
+#define READ_PEDALS_FROM_SHIFT_REGISTERS
+
+#include "PedalInputs/ShiftRegisterPedalInput.cpp"
+
+// The simulated chain. Each register's parallel inputs are latched when SH/LD is pulsed low, and shifted out on QH,
+// D7 first, one bit per SPI clock; each register's SER input is the next register's QH, and the last register's SER is pulled up.
+static uint8_t registerInputs[NumPedalShiftRegisters];
+static uint8_t registerContents[NumPedalShiftRegisters];
+static uint16_t numLatchedLoadPulses;
+static uint8_t numTransfersSinceLoad;
+
+static uint8_t TransferChainByte(uint8_t)
+{
+  if (HostPinLowWriteCount(PedalShiftRegisterLoadPin) != numLatchedLoadPulses)
+  {
+    numLatchedLoadPulses = HostPinLowWriteCount(PedalShiftRegisterLoadPin);
+    memcpy(registerContents, registerInputs, sizeof(registerContents));
+    numTransfersSinceLoad = 0;
+  }
+
+  uint8_t receivedByte = 0;
+  for (uint8_t bit = 0; bit < 8; bit++)
+  {
+    receivedByte = (receivedByte << 1) | (registerContents[0] >> 7);
+    for (uint8_t i = 0; i < NumPedalShiftRegisters; i++)
+    {
+      uint8_t serialInput = i + 1 < NumPedalShiftRegisters ? registerContents[i + 1] >> 7 : 1;
+      registerContents[i] = (registerContents[i] << 1) | serialInput;
+    }
+  }
+
+  numTransfersSinceLoad++;
+  return receivedByte;
+}
+
+// This function sets the level of pedal N's input, D(N % 8) of register N / 8; a pressed pedal pulls its input low.
+static void SetPedalPressed(uint8_t pedal, bool isPressed)
+{
+  uint8_t inputMask = 1 << (pedal % 8);
+  if (isPressed)
+  {
+    registerInputs[pedal / 8] &= ~inputMask;
+  }
+  else
+  {
+    registerInputs[pedal / 8] |= inputMask;
+  }
+}
+
+static ShiftRegisterPedalInput shiftRegisterPedalInput;
+
+void setUp()
+{
+  memset(registerInputs, 0xFF, sizeof(registerInputs));
+  memset(registerContents, 0xFF, sizeof(registerContents));
+  numLatchedLoadPulses = HostPinLowWriteCount(PedalShiftRegisterLoadPin);
+  numTransfersSinceLoad = 0;
+  HostSetSpiTransfer(TransferChainByte);
+
+  shiftRegisterPedalInput.Setup();
+}
+
+void tearDown()
+{
+  HostSetSpiTransfer(NULL);
+}
+
+void TestNoPedalPressed()
+{
+  TEST_ASSERT_EQUAL_HEX32(0, shiftRegisterPedalInput.ReadPressedFlags());
+}
+
+void TestEachPedalSetsItsFlag()
+{
+  for (uint8_t pedal = 0; pedal < NumDigitalPedals; pedal++)
+  {
+    SetPedalPressed(pedal, true);
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE((PedalFlags)1 << pedal, shiftRegisterPedalInput.ReadPressedFlags(), "A pressed pedal did not set its flag.");
+    SetPedalPressed(pedal, false);
+  }
+}
+
+void TestAllPedalsPressed()
+{
+  memset(registerInputs, 0, sizeof(registerInputs));
+  TEST_ASSERT_EQUAL_HEX32((PedalFlags)(((uint64_t)1 << NumDigitalPedals) - 1), shiftRegisterPedalInput.ReadPressedFlags());
+}
+
+void TestScanReadsTheWholeChainAfterOneLoadPulse()
+{
+  uint16_t numLoadPulses = HostPinLowWriteCount(PedalShiftRegisterLoadPin);
+
+  SetPedalPressed(NumDigitalPedals - 1, true);
+  TEST_ASSERT_EQUAL_HEX32((PedalFlags)1 << (NumDigitalPedals - 1), shiftRegisterPedalInput.ReadPressedFlags());
+  TEST_ASSERT_EQUAL(numLoadPulses + 1, HostPinLowWriteCount(PedalShiftRegisterLoadPin));
+  TEST_ASSERT_EQUAL(NumPedalShiftRegisters, numTransfersSinceLoad);
+  TEST_ASSERT_EQUAL(HIGH, HostPinOutputLevel(PedalShiftRegisterLoadPin));
+
+  // The next scan latches the inputs again.
+  SetPedalPressed(NumDigitalPedals - 1, false);
+  SetPedalPressed(0, true);
+  TEST_ASSERT_EQUAL_HEX32(1, shiftRegisterPedalInput.ReadPressedFlags());
+  TEST_ASSERT_EQUAL(numLoadPulses + 2, HostPinLowWriteCount(PedalShiftRegisterLoadPin));
+}
+
+void TestRegisterBytesMapToFlags()
+{
+  // Register 0's D0 and D7, register 1's D1, and the last register's D7 are low.
+  uint8_t registerBytes[NumPedalShiftRegisters];
+  memset(registerBytes, 0xFF, sizeof(registerBytes));
+  registerBytes[0] = 0x7E;
+  registerBytes[1] = 0xFD;
+  registerBytes[NumPedalShiftRegisters - 1] &= 0x7F;
+
+  PedalFlags expectedFlags = (PedalFlags)0x0281 | ((PedalFlags)0x80 << (8 * (NumPedalShiftRegisters - 1)));
+  TEST_ASSERT_EQUAL_HEX32(expectedFlags, ShiftRegisterPedalInput::GetPressedFlags(registerBytes));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestNoPedalPressed);
+  RUN_TEST(TestEachPedalSetsItsFlag);
+  RUN_TEST(TestAllPedalsPressed);
+  RUN_TEST(TestScanReadsTheWholeChainAfterOneLoadPulse);
+  RUN_TEST(TestRegisterBytesMapToFlags);
+  return UNITY_END();
+}
@@ -0,0 +1,189 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests the style catalog against the style list it is generated from, "sx900 style sysex.txt":
+// each style must be found by its style number and by its catalog order, with its name and category.
+// The style list is read as tools/generate_style_catalog.py reads it.
+
+#include <unity.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "KeyboardProfiles/StyleCatalog.cpp"
+
+// A style of the style list.
+struct ListedStyle
+{
+  uint16_t catalogOrder;
+  std::string categoryName;
+  std::string name;
+  uint16_t styleNum;
+};
+
+std::vector<ListedStyle> gListedStyles;
+
+// This function returns the path of the style list, in the project directory; the tests are run from there,
+// but the path is taken from this file's path when it has one.
+std::string GetStyleListPath()
+{
+  std::string testPath = __FILE__;
+  std::string testSuffix = "test/native/test_style_catalog/test_main.cpp";
+  std::string projectDir;
+  if (testPath.size() >= testSuffix.size() && testPath.compare(testPath.size() - testSuffix.size(), testSuffix.size(), testSuffix) == 0)
+  {
+    projectDir = testPath.substr(0, testPath.size() - testSuffix.size());
+  }
+
+  return projectDir + "sx900 style sysex.txt";
+}
+
+std::string Trim(const std::string& text)
+{
+  size_t first = text.find_first_not_of(" \r\n");
+  size_t last = text.find_last_not_of(" \r\n");
+  return first == std::string::npos ? "" : text.substr(first, last + 1 - first);
+}
+
+bool IsNumber(const std::string& text)
+{
+  return !text.empty() && text.find_first_not_of("0123456789") == std::string::npos;
+}
+
+// This function reads the data rows: the order, the category name, the category number, the order in the category,
+// the name, and the MSB and LSB, in hex; some rows have an empty column before the MSB.
+void ReadStyleList()
+{
+  std::ifstream styleList(GetStyleListPath().c_str());
+  TEST_ASSERT_TRUE_MESSAGE(styleList.is_open(), "The style list cannot be opened.");
+
+  std::string line;
+  while (std::getline(styleList, line))
+  {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    size_t tab;
+    while ((tab = line.find('\t', start)) != std::string::npos)
+    {
+      fields.push_back(Trim(line.substr(start, tab - start)));
+      start = tab + 1;
+    }
+    fields.push_back(Trim(line.substr(start)));
+
+    if (fields.size() < 7 || !IsNumber(fields[0]) || IsNumber(fields[1]) || !IsNumber(fields[2]))
+    {
+      continue;
+    }
+
+    std::vector<std::string> idFields;
+    for (size_t i = 5; i < fields.size(); i++)
+    {
+      if (!fields[i].empty())
+      {
+        idFields.push_back(fields[i]);
+      }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(2, idFields.size(), fields[0].c_str());
+    uint16_t msb = (uint16_t)strtoul(idFields[0].c_str(), NULL, 16);
+    uint16_t lsb = (uint16_t)strtoul(idFields[1].c_str(), NULL, 16);
+    gListedStyles.push_back(ListedStyle{(uint16_t)atoi(fields[0].c_str()), fields[1], fields[4], (uint16_t)(msb << 8 | lsb)});
+  }
+}
+
+// The style list is read once, by the first test.
+void setUp()
+{
+  if (gListedStyles.empty())
+  {
+    ReadStyleList();
+  }
+}
+
+void tearDown()
+{
+}
+
+void TestNumStyles()
+{
+  TEST_ASSERT_EQUAL_UINT16(gListedStyles.size(), GetNumCatalogStyles());
+  for (size_t i = 0; i < gListedStyles.size(); i++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(i + 1, gListedStyles[i].catalogOrder);
+  }
+}
+
+void TestFindCatalogStyle()
+{
+  for (const ListedStyle& listedStyle : gListedStyles)
+  {
+    uint16_t entryIndex = FindCatalogStyle(listedStyle.styleNum);
+    TEST_ASSERT_TRUE_MESSAGE(entryIndex != NoCatalogEntryIndex, listedStyle.name.c_str());
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE(listedStyle.styleNum, GetCatalogStyleNum(entryIndex), listedStyle.name.c_str());
+  }
+
+  // A style number that is not listed; the MSB and LSB are 7 bits.
+  TEST_ASSERT_EQUAL_UINT16(NoCatalogEntryIndex, FindCatalogStyle(0x0080));
+}
+
+void TestGetCatalogOrderEntryIndex()
+{
+  for (const ListedStyle& listedStyle : gListedStyles)
+  {
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(FindCatalogStyle(listedStyle.styleNum), GetCatalogOrderEntryIndex(listedStyle.catalogOrder), listedStyle.name.c_str());
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(NoCatalogEntryIndex, GetCatalogOrderEntryIndex(0));
+  TEST_ASSERT_EQUAL_UINT16(NoCatalogEntryIndex, GetCatalogOrderEntryIndex(GetNumCatalogStyles() + 1));
+}
+
+void TestReadCatalogStyleName()
+{
+  for (const ListedStyle& listedStyle : gListedStyles)
+  {
+    uint16_t entryIndex = GetCatalogOrderEntryIndex(listedStyle.catalogOrder);
+
+    char name[64];
+    TEST_ASSERT_EQUAL_UINT8(listedStyle.name.size(), ReadCatalogStyleName(entryIndex, name, sizeof(name) - 1));
+    TEST_ASSERT_EQUAL_STRING(listedStyle.name.c_str(), name);
+    TEST_ASSERT_EQUAL_STRING(listedStyle.categoryName.c_str(), (const char*)GetCatalogCategoryName(GetCatalogStyleCategoryIndex(entryIndex)));
+
+    // A truncated name is still terminated.
+    TEST_ASSERT_EQUAL_UINT8(3, ReadCatalogStyleName(entryIndex, name, 3));
+    TEST_ASSERT_EQUAL_STRING(listedStyle.name.substr(0, 3).c_str(), name);
+  }
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestNumStyles);
+  RUN_TEST(TestFindCatalogStyle);
+  RUN_TEST(TestGetCatalogOrderEntryIndex);
+  RUN_TEST(TestReadCatalogStyleName);
+  return UNITY_END();
+}
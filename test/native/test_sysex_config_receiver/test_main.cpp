@@ -0,0 +1,203 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests the configuration messages received by SysExConfigReceiver, and the configuration they apply and persist.
+
+#include <unity.h>
+
+#include "MidiAccompanimentController.h"
+#define RECEIVE_SYSEX_CONFIG
+
+#include "SysExConfig/SysExConfigReceiver.cpp"
+#include "FootPedalSwitchChangeManager.cpp"
+#include "MidiTransmitQueue.cpp"
+#include "PedalConfigStore.cpp"
+#include "StatusManager.cpp"
+#include "MIDIEventFlasher.cpp"
+#include "PedalBoards.cpp"
+#include "KeyboardProfiles/StyleCatalog.cpp"
+#include "Utilities/Utilities.cpp"
+
+MIDIEventFlasher gMIDIEventFlasher;
+StatusManager gStatusManager;
+
+// The pedal that selects the next registration bank; a Section Control board pedal, which the banks do not assign.
+const uint8_t NextBankPedal = 0;
+
+MidiTransmitQueue* gMidiTransmitQueue;
+FootPedalSwitchChangeManager* gFootPedalSwitchChangeManager;
+SysExConfigReceiver* gSysExConfigReceiver;
+PedalConfig gBaseConfig;
+
+void setUp()
+{
+  memset(HostEeprom(), 0xFF, E2END + 1);
+  HostSerial().HostSetNumFreeBytes(HostSerialTransmitBufferSize);
+
+  gMidiTransmitQueue = new MidiTransmitQueue();
+  gFootPedalSwitchChangeManager = new FootPedalSwitchChangeManager(gStatusManager, *gMidiTransmitQueue);
+  gFootPedalSwitchChangeManager->Setup();
+
+  gBaseConfig = gFootPedalSwitchChangeManager->GetPedalConfig();
+  gBaseConfig.pedalActions[NextBankPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::NextRegistrationBank);
+  gFootPedalSwitchChangeManager->ApplyPedalConfig(gBaseConfig);
+
+  gSysExConfigReceiver = new SysExConfigReceiver(*gFootPedalSwitchChangeManager);
+  gSysExConfigReceiver->Setup();
+}
+
+void tearDown()
+{
+  delete gSysExConfigReceiver;
+  delete gFootPedalSwitchChangeManager;
+  delete gMidiTransmitQueue;
+}
+
+// This function receives a configuration message, and updates the receiver until it is handled, and any save is written.
+void ReceiveConfigMessage(uint8_t command, const std::vector<uint8_t>& payload)
+{
+  std::vector<uint8_t> crcBytes = {SysExConfigMessageType, command};
+  crcBytes.insert(crcBytes.end(), payload.begin(), payload.end());
+  uint8_t crc = GetPedalLinkCrc(crcBytes.data(), (uint8_t)crcBytes.size());
+
+  std::vector<uint8_t> messageBytes = {0xF0, PedalLinkManufacturerId};
+  messageBytes.insert(messageBytes.end(), crcBytes.begin(), crcBytes.end());
+  messageBytes.push_back(crc >> 4);
+  messageBytes.push_back(crc & 0x0F);
+  messageBytes.push_back(0xF7);
+  HostSerial().HostReceiveBytes(messageBytes);
+
+  for (uint16_t i = 0; i < 1000; i++)
+  {
+    gSysExConfigReceiver->Update();
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, HostSerial().available());
+}
+
+void AssertConfigsEqual(const PedalConfig& expectedConfig, const PedalConfig& pedalConfig)
+{
+  TEST_ASSERT_EQUAL_HEX8_ARRAY((const uint8_t*)&expectedConfig, (const uint8_t*)&pedalConfig, sizeof(PedalConfig));
+}
+
+// Reverting while a registration bank is active stages bank 0's configuration; applying and saving it leaves bank 0 unchanged.
+void TestRevertInBankStagesBaseConfig()
+{
+  gFootPedalSwitchChangeManager->HandleButtonChange(NextBankPedal, true);
+  TEST_ASSERT_NOT_EQUAL(gBaseConfig.defaultTempo, gFootPedalSwitchChangeManager->GetPedalConfig().defaultTempo);
+
+  ReceiveConfigMessage(SysExConfigCommand::RevertConfigCommand, {});
+  ReceiveConfigMessage(SysExConfigCommand::ApplyConfigCommand, {SysExConfigPersistFlag});
+  TEST_ASSERT_EQUAL_UINT16(0, gSysExConfigReceiver->GetNumMessageErrors());
+
+  AssertConfigsEqual(gBaseConfig, gFootPedalSwitchChangeManager->GetBaseConfig());
+  AssertConfigsEqual(gBaseConfig, gFootPedalSwitchChangeManager->GetPedalConfig());
+
+  PedalConfig savedConfig;
+  TEST_ASSERT_TRUE(PedalConfigStore::Load(savedConfig));
+  AssertConfigsEqual(gBaseConfig, savedConfig);
+}
+
+// The configuration staged at setup is bank 0's, even when the receiver is set up while a bank is active.
+void TestSetupInBankStagesBaseConfig()
+{
+  gFootPedalSwitchChangeManager->HandleButtonChange(NextBankPedal, true);
+  gSysExConfigReceiver->Setup();
+
+  ReceiveConfigMessage(SysExConfigCommand::ApplyConfigCommand, {0});
+  AssertConfigsEqual(gBaseConfig, gFootPedalSwitchChangeManager->GetBaseConfig());
+}
+
+// An action parameter with the high bit set would break the keyboard's SysEx message; Apply rejects it.
+void TestApplyRejectsParamsAbove7Bits()
+{
+  ReceiveConfigMessage(SysExConfigCommand::SetPedalActionCommand, {1, PedalEdge::PressEdge, PedalActionType::SectionSwitchOn, 0x08, 0x00, 0x00, 0x00});
+  ReceiveConfigMessage(SysExConfigCommand::ApplyConfigCommand, {0});
+  TEST_ASSERT_EQUAL_UINT16(1, gSysExConfigReceiver->GetNumMessageErrors());
+  AssertConfigsEqual(gBaseConfig, gFootPedalSwitchChangeManager->GetPedalConfig());
+
+  ReceiveConfigMessage(SysExConfigCommand::RevertConfigCommand, {});
+  ReceiveConfigMessage(SysExConfigCommand::SetPedalStyleCommand, {1, 0x08, 0x0E, 0x05, 0x02});
+  ReceiveConfigMessage(SysExConfigCommand::ApplyConfigCommand, {0});
+  TEST_ASSERT_EQUAL_UINT16(2, gSysExConfigReceiver->GetNumMessageErrors());
+  AssertConfigsEqual(gBaseConfig, gFootPedalSwitchChangeManager->GetPedalConfig());
+
+  // The largest 7-bit parameters are applied.
+  ReceiveConfigMessage(SysExConfigCommand::RevertConfigCommand, {});
+  ReceiveConfigMessage(SysExConfigCommand::SetPedalStyleCommand, {1, 0x07, 0x0F, 0x07, 0x0F});
+  ReceiveConfigMessage(SysExConfigCommand::ApplyConfigCommand, {0});
+  TEST_ASSERT_EQUAL_UINT16(2, gSysExConfigReceiver->GetNumMessageErrors());
+  TEST_ASSERT_EQUAL_HEX8(0x7F, gFootPedalSwitchChangeManager->GetPedalConfig().pedalActions[1][PedalEdge::PressEdge].param0);
+}
+
+// A saved configuration with a parameter above 7 bits, and a good CRC, is not loaded.
+void TestLoadRejectsParamsAbove7Bits()
+{
+  PedalConfig pedalConfig = gBaseConfig;
+  pedalConfig.pedalActions[1][PedalEdge::PressEdge] = MakeSelectStyleAction(0x1E80);
+  PedalConfigStore::Save(pedalConfig);
+  TEST_ASSERT_FALSE(PedalConfigStore::Load(pedalConfig));
+
+  PedalConfigStore::Save(gBaseConfig);
+  TEST_ASSERT_TRUE(PedalConfigStore::Load(pedalConfig));
+}
+
+// A registration bank's default tempo outside the configured tempo limits is clamped to them.
+void TestBankDefaultTempoIsWithinLimits()
+{
+  PedalConfig pedalConfig = gBaseConfig;
+  pedalConfig.minTempo = 115;
+  pedalConfig.defaultTempo = 116;
+  pedalConfig.maxTempo = 118;
+  gFootPedalSwitchChangeManager->ApplyPedalConfig(pedalConfig);
+
+  // The Pop bank's tempo is 110.
+  gFootPedalSwitchChangeManager->HandleButtonChange(NextBankPedal, true);
+  gFootPedalSwitchChangeManager->HandleButtonChange(NextBankPedal, false);
+  TEST_ASSERT_EQUAL_UINT8(115, gFootPedalSwitchChangeManager->GetPedalConfig().defaultTempo);
+  TEST_ASSERT_TRUE(PedalConfigStore::IsValid(gFootPedalSwitchChangeManager->GetPedalConfig()));
+
+  // The Rock bank's tempo is 126.
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    gFootPedalSwitchChangeManager->HandleButtonChange(NextBankPedal, true);
+    gFootPedalSwitchChangeManager->HandleButtonChange(NextBankPedal, false);
+  }
+
+  TEST_ASSERT_EQUAL_UINT8(118, gFootPedalSwitchChangeManager->GetPedalConfig().defaultTempo);
+  TEST_ASSERT_TRUE(PedalConfigStore::IsValid(gFootPedalSwitchChangeManager->GetPedalConfig()));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestRevertInBankStagesBaseConfig);
+  RUN_TEST(TestSetupInBankStagesBaseConfig);
+  RUN_TEST(TestApplyRejectsParamsAbove7Bits);
+  RUN_TEST(TestLoadRejectsParamsAbove7Bits);
+  RUN_TEST(TestBankDefaultTempoIsWithinLimits);
+  return UNITY_END();
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests SysExFrameParser with byte streams that contain System Real-Time bytes, other status bytes, and long messages.
+
+#include <unity.h>
+
+#include "Utilities/SysExFrameParser.h"
+
+typedef SysExFrameParser<4> TestFrameParser;
+
+// This function parses the bytes, and returns the result of the last byte.
+static TestFrameParser::ParseResult ParseBytes(TestFrameParser& frameParser, const uint8_t* bytes, uint8_t numBytes)
+{
+  TestFrameParser::ParseResult result = TestFrameParser::NoFrame;
+  for (uint8_t i = 0; i < numBytes; i++)
+  {
+    result = frameParser.ParseByte(bytes[i]);
+  }
+
+  return result;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void TestFrameIsReceived()
+{
+  TestFrameParser frameParser;
+  const uint8_t bytes[] = {0xF0, 0x7D, 0x01, 0x02, 0xF7};
+
+  TEST_ASSERT_EQUAL(TestFrameParser::FrameReceived, ParseBytes(frameParser, bytes, sizeof(bytes)));
+  TEST_ASSERT_EQUAL_UINT8(3, frameParser.GetNumFrameBytes());
+  TEST_ASSERT_EQUAL_UINT8(0x02, frameParser.GetFrameBytes()[2]);
+  TEST_ASSERT_FALSE(frameParser.IsFrameOverrun());
+}
+
+void TestRealTimeBytesAreSkippedWithinAFrame()
+{
+  TestFrameParser frameParser;
+
+  // MIDI Clock, Start, Continue, Stop, Active Sensing and Reset, between the frame's bytes.
+  const uint8_t bytes[] = {0xF0, 0xF8, 0x7D, 0xFA, 0xFB, 0x01, 0xFC, 0xFE, 0x02, 0xFF, 0xF9, 0xFD};
+  for (uint8_t i = 0; i < sizeof(bytes); i++)
+  {
+    TestFrameParser::ParseResult result = frameParser.ParseByte(bytes[i]);
+    if (bytes[i] >= FirstRealTimeByte)
+    {
+      TEST_ASSERT_EQUAL(TestFrameParser::NoFrame, result);
+    }
+  }
+
+  TEST_ASSERT_EQUAL(TestFrameParser::FrameReceived, frameParser.ParseByte(SysExEndByte));
+  TEST_ASSERT_EQUAL_UINT8(3, frameParser.GetNumFrameBytes());
+  TEST_ASSERT_EQUAL_UINT8(0x7D, frameParser.GetFrameBytes()[0]);
+  TEST_ASSERT_EQUAL_UINT8(0x01, frameParser.GetFrameBytes()[1]);
+  TEST_ASSERT_EQUAL_UINT8(0x02, frameParser.GetFrameBytes()[2]);
+}
+
+void TestOtherStatusByteAbortsAFrame()
+{
+  TestFrameParser frameParser;
+  const uint8_t bytes[] = {0xF0, 0x7D, 0x01, 0x90};
+
+  TEST_ASSERT_EQUAL(TestFrameParser::FrameAborted, ParseBytes(frameParser, bytes, sizeof(bytes)));
+
+  // The bytes after the aborted frame are outside any frame.
+  TEST_ASSERT_EQUAL(TestFrameParser::NoFrame, frameParser.ParseByte(0x02));
+  TEST_ASSERT_EQUAL(TestFrameParser::NoFrame, frameParser.ParseByte(SysExEndByte));
+}
+
+void TestStartByteRestartsAFrame()
+{
+  TestFrameParser frameParser;
+  const uint8_t bytes[] = {0xF0, 0x7D, 0x01, 0xF0};
+
+  TEST_ASSERT_EQUAL(TestFrameParser::FrameRestarted, ParseBytes(frameParser, bytes, sizeof(bytes)));
+  TEST_ASSERT_EQUAL_UINT8(0, frameParser.GetNumFrameBytes());
+}
+
+void TestLongFrameIsOverrun()
+{
+  TestFrameParser frameParser;
+  const uint8_t bytes[] = {0xF0, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xF7};
+
+  TEST_ASSERT_EQUAL(TestFrameParser::FrameReceived, ParseBytes(frameParser, bytes, sizeof(bytes)));
+  TEST_ASSERT_EQUAL_UINT8(4, frameParser.GetNumFrameBytes());
+  TEST_ASSERT_TRUE(frameParser.IsFrameOverrun());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestFrameIsReceived);
+  RUN_TEST(TestRealTimeBytesAreSkippedWithinAFrame);
+  RUN_TEST(TestOtherStatusByteAbortsAFrame);
+  RUN_TEST(TestStartByteRestartsAFrame);
+  RUN_TEST(TestLongFrameIsOverrun);
+  return UNITY_END();
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests VerticalCounterDebouncer with bounce traces; a pedal toggles after exactly four consecutive differing samples.
+
+#include <unity.h>
+
+#include "Debouncers/VerticalCounterDebouncer.cpp"
+
+// This function feeds the raw samples of pedal 0, given as '0' (released) and '1' (pressed) characters,
+// and checks its debounced state after each sample against the expected trace.
+static void CheckTrace(VerticalCounterDebouncer& debouncer, const char* rawTrace, const char* expectedTrace)
+{
+  TEST_ASSERT_EQUAL(strlen(rawTrace), strlen(expectedTrace));
+
+  for (uint8_t i = 0; rawTrace[i] != '\0'; i++)
+  {
+    PedalFlags debouncedFlags = debouncer.Update(rawTrace[i] == '1' ? 1 : 0);
+    TEST_ASSERT_EQUAL_MESSAGE(expectedTrace[i] == '1' ? 1 : 0, debouncedFlags, "The debounced state differs from the expected trace.");
+  }
+}
+
+void setUp()
+{
+  HostSetMillis(0);
+}
+
+void tearDown()
+{
+}
+
+void TestPressTogglesAfterFourSamples()
+{
+  VerticalCounterDebouncer debouncer;
+  CheckTrace(debouncer, "11111", "00011");
+}
+
+void TestReleaseTogglesAfterFourSamples()
+{
+  VerticalCounterDebouncer debouncer;
+  CheckTrace(debouncer, "1111", "0001");
+  CheckTrace(debouncer, "00000", "11100");
+}
+
+void TestBounceRestartsTheCount()
+{
+  VerticalCounterDebouncer debouncer;
+  CheckTrace(debouncer, "1101111", "0000001");
+  CheckTrace(debouncer, "0010000", "1111110");
+}
+
+void TestShorterPulsesNeverToggle()
+{
+  VerticalCounterDebouncer debouncer;
+  CheckTrace(debouncer, "111011101110", "000000000000");
+  CheckTrace(debouncer, "1111", "0001");
+  CheckTrace(debouncer, "0001000100010", "1111111111111");
+}
+
+void TestPedalsAreDebouncedIndependently()
+{
+  VerticalCounterDebouncer debouncer;
+  const PedalFlags FirstPedalFlag = 1;
+  const PedalFlags LastPedalFlag = (PedalFlags)1 << (NumFootPedalButtons - 1);
+
+  // The last pedal is pressed two samples after the first, and bounces once.
+  const PedalFlags rawFlags[] = {FirstPedalFlag, FirstPedalFlag, FirstPedalFlag | LastPedalFlag, FirstPedalFlag, FirstPedalFlag | LastPedalFlag,
+    FirstPedalFlag | LastPedalFlag, FirstPedalFlag | LastPedalFlag, FirstPedalFlag | LastPedalFlag};
+  const PedalFlags expectedFlags[] = {0, 0, 0, FirstPedalFlag, FirstPedalFlag,
+    FirstPedalFlag, FirstPedalFlag, FirstPedalFlag | LastPedalFlag};
+
+  for (uint8_t i = 0; i < sizeof(rawFlags) / sizeof(rawFlags[0]); i++)
+  {
+    TEST_ASSERT_EQUAL_HEX32(expectedFlags[i], debouncer.Update(rawFlags[i]));
+  }
+
+  TEST_ASSERT_EQUAL_HEX32(FirstPedalFlag | LastPedalFlag, debouncer.GetDebouncedFlags());
+}
+
+void TestSampleIsDueEveryTick()
+{
+  VerticalCounterDebouncer debouncer;
+  HostSetMillis(1000);
+  TEST_ASSERT_TRUE(debouncer.IsSampleDue());
+  TEST_ASSERT_FALSE(debouncer.IsSampleDue());
+
+  HostAdvanceMillis(VerticalCounterSampleTickMs - 1);
+  TEST_ASSERT_FALSE(debouncer.IsSampleDue());
+
+  HostAdvanceMillis(1);
+  TEST_ASSERT_TRUE(debouncer.IsSampleDue());
+}
+
+void TestSampleTickAcrossRollovers()
+{
+  VerticalCounterDebouncer debouncer;
+
+  // The sample time's low byte rolls over.
+  HostSetMillis(255);
+  TEST_ASSERT_TRUE(debouncer.IsSampleDue());
+  HostSetMillis(255 + VerticalCounterSampleTickMs - 1);
+  TEST_ASSERT_FALSE(debouncer.IsSampleDue());
+  HostSetMillis(255 + VerticalCounterSampleTickMs);
+  TEST_ASSERT_TRUE(debouncer.IsSampleDue());
+
+  // millis() rolls over.
+  HostSetMillis(0xFFFFFFFF);
+  TEST_ASSERT_TRUE(debouncer.IsSampleDue());
+  HostAdvanceMillis(VerticalCounterSampleTickMs - 1);
+  TEST_ASSERT_FALSE(debouncer.IsSampleDue());
+  HostAdvanceMillis(1);
+  TEST_ASSERT_TRUE(debouncer.IsSampleDue());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestPressTogglesAfterFourSamples);
+  RUN_TEST(TestReleaseTogglesAfterFourSamples);
+  RUN_TEST(TestBounceRestartsTheCount);
+  RUN_TEST(TestShorterPulsesNeverToggle);
+  RUN_TEST(TestPedalsAreDebouncedIndependently);
+  RUN_TEST(TestSampleIsDueEveryTick);
+  RUN_TEST(TestSampleTickAcrossRollovers);
+  return UNITY_END();
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+  test_main.cpp
+  
+  MIDI Accompaniment Controller
+  https://github.com/BarryKVibes/MidiAccompanimentController
+  Copyright 2022, Barry K Vibes
+  
+ *******************************************************************************
+  
+  This file is part of MidiAccompanimentController.
+  
+  MidiAccompanimentController is free software: you can redistribute it and/or 
+  modify it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  MidiAccompanimentController is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License along 
+  with MidiAccompanimentController. If not, see <https://www.gnu.org/licenses/>.
+  
+ ******************************************************************************/
+
+// This file tests the SysEx messages sent to the keyboard with the Yamaha arranger profile, byte for byte, and its tempo range.
+// The PSR-SX700 and Genos selections are aliases of it, and send the same bytes; see KeyboardProfile.h.
+
+#include <unity.h>
+
+#include "FootPedalSwitchChangeManager.cpp"
+#include "MidiTransmitQueue.cpp"
+#include "PedalConfigStore.cpp"
+#include "StatusManager.cpp"
+#include "MIDIEventFlasher.cpp"
+#include "PedalBoards.cpp"
+#include "KeyboardProfiles/StyleCatalog.cpp"
+#include "Utilities/Utilities.cpp"
+
+MIDIEventFlasher gMIDIEventFlasher;
+StatusManager gStatusManager;
+
+// The pedals of the test configuration.
+enum TestPedal
+{
+  StylePedal,
+  TempoUpPedal,
+  TempoDownPedal,
+  MainBPedal
+};
+
+MidiTransmitQueue* gMidiTransmitQueue;
+FootPedalSwitchChangeManager* gFootPedalSwitchChangeManager;
+
+void setUp()
+{
+  memset(HostEeprom(), 0xFF, E2END + 1);
+  HostSerial().HostWrittenBytes().clear();
+  HostSerial().HostSetNumFreeBytes(HostSerialTransmitBufferSize);
+
+  gMidiTransmitQueue = new MidiTransmitQueue();
+  gFootPedalSwitchChangeManager = new FootPedalSwitchChangeManager(gStatusManager, *gMidiTransmitQueue);
+  gFootPedalSwitchChangeManager->Setup();
+
+  PedalConfig pedalConfig = gFootPedalSwitchChangeManager->GetPedalConfig();
+  for (uint8_t i = 0; i < NumConfigurablePedals; i++)
+  {
+    pedalConfig.pedalActions[i][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::NoAction);
+    pedalConfig.pedalActions[i][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::NoAction);
+  }
+
+  pedalConfig.pedalActions[StylePedal][PedalEdge::PressEdge] = MakeSelectStyleAction(StyleNum::BigBandSwing);
+  pedalConfig.pedalActions[TempoUpPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::TempoUp);
+  pedalConfig.pedalActions[TempoDownPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::TempoDown);
+  pedalConfig.pedalActions[MainBPedal][PedalEdge::PressEdge] = MakePedalAction(PedalActionType::SectionSwitchOn, StyleSectionControlSwitchNum::MainB);
+  pedalConfig.pedalActions[MainBPedal][PedalEdge::ReleaseEdge] = MakePedalAction(PedalActionType::SectionSwitchOff, StyleSectionControlSwitchNum::MainB);
+  pedalConfig.defaultTempo = 120;
+  gFootPedalSwitchChangeManager->ApplyPedalConfig(pedalConfig);
+}
+
+void tearDown()
+{
+  delete gFootPedalSwitchChangeManager;
+  delete gMidiTransmitQueue;
+}
+
+// This function presses the pedal, and returns the bytes written to the keyboard; the UART is drained before each step.
+std::vector<uint8_t> PressPedal(uint8_t buttonIndex, bool isActive = true)
+{
+  HostSerial().HostWrittenBytes().clear();
+  HostSerial().HostSetNumFreeBytes(HostSerialTransmitBufferSize);
+  gFootPedalSwitchChangeManager->HandleButtonChange(buttonIndex, isActive);
+  return HostSerial().HostWrittenBytes();
+}
+
+void AssertBytes(const std::vector<uint8_t>& expectedBytes, const std::vector<uint8_t>& writtenBytes)
+{
+  TEST_ASSERT_EQUAL_UINT32(expectedBytes.size(), writtenBytes.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expectedBytes.data(), writtenBytes.data(), expectedBytes.size());
+}
+
+void TestStyleSelectSysEx()
+{
+  AssertBytes({0xF0, 0x43, 0x73, 0x01, 0x51, 0x05, 0x00, 0x03, 0x04, 0x00, 0x00, 0x1E, 0x52, 0xF7}, PressPedal(StylePedal));
+}
+
+void TestSectionControlSysEx()
+{
+  AssertBytes({0xF0, 0x43, 0x7E, 0x00, 0x09, 0x7F, 0xF7}, PressPedal(MainBPedal));
+  AssertBytes({0xF0, 0x43, 0x7E, 0x00, 0x09, 0x00, 0xF7}, PressPedal(MainBPedal, false));
+}
+
+// The tempo is sent as microseconds per quarter note: 120 BPM is 500000 = 0x07A120, which is 00 1E 42 20 in 7-bit bytes.
+// The first tempo change sends the default tempo.
+void TestTempoSysEx()
+{
+  AssertBytes({0xF0, 0x43, 0x7E, 0x01, 0x00, 0x1E, 0x42, 0x20, 0xF7}, PressPedal(TempoUpPedal));
+  AssertBytes({0xF0, 0x43, 0x7E, 0x01, 0x00, 0x1E, 0x21, 0x7B, 0xF7}, PressPedal(TempoUpPedal));
+  AssertBytes({0xF0, 0x43, 0x7E, 0x01, 0x00, 0x1E, 0x42, 0x20, 0xF7}, PressPedal(TempoDownPedal));
+  AssertBytes({0xF0, 0x43, 0x7E, 0x01, 0x00, 0x1E, 0x63, 0x09, 0xF7}, PressPedal(TempoDownPedal));
+}
+
+// The keyboard accepts tempos past 255, which the 8-bit tempos of the pedal configuration cannot hold.
+void TestConfigTempoLimit()
+{
+  TEST_ASSERT_EQUAL_UINT16(5, KeyboardMinTempo);
+  TEST_ASSERT_EQUAL_UINT16(500, KeyboardMaxTempo);
+  TEST_ASSERT_EQUAL_UINT8(255, MaxConfigTempo);
+
+  PedalConfig pedalConfig = gFootPedalSwitchChangeManager->GetPedalConfig();
+  pedalConfig.maxTempo = MaxConfigTempo;
+  TEST_ASSERT_TRUE(PedalConfigStore::IsValid(pedalConfig));
+
+  pedalConfig.minTempo = KeyboardMinTempo - 1;
+  TEST_ASSERT_FALSE(PedalConfigStore::IsValid(pedalConfig));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(TestStyleSelectSysEx);
+  RUN_TEST(TestSectionControlSysEx);
+  RUN_TEST(TestTempoSysEx);
+  RUN_TEST(TestConfigTempoLimit);
+  return UNITY_END();
+}
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""Generates the flash-resident PSR-SX900 style catalog from "sx900 style sysex.txt".
+
+The output, src/KeyboardProfiles/PsrSx900StyleCatalogData.h, is committed, so the Arduino IDE can build without this step.
+PlatformIO runs this script before each build (extra_scripts in platformio.ini); the header is only rewritten when it changes.
+
+Usage:
+  generate_style_catalog.py           regenerates the header
+  generate_style_catalog.py --check   checks that the header is up to date, and round-trips against the style list
+"""
+
+import os
+import re
+import sys
+
+STYLE_LIST_FILE = "sx900 style sysex.txt"
+CATALOG_FILE = os.path.join("src", "KeyboardProfiles", "PsrSx900StyleCatalogData.h")
+
+
+def read_styles(style_list_path):
+    """Returns the styles, in catalog order, as (order, category, order in category, name, style number) tuples."""
+    styles = []
+    with open(style_list_path, encoding="ascii") as style_list:
+        for line in style_list:
+            fields = [field.strip() for field in line.rstrip("\r\n").split("\t")]
+            # The data rows start with the order, and a category name; the row of column counts is skipped.
+            if len(fields) < 7 or not fields[0].isdigit() or fields[1].isdigit() or not fields[2].isdigit():
+                continue
+
+            # The MSB and LSB follow the name; some rows have an empty column before the MSB.
+            id_fields = [field for field in fields[5:] if field]
+            if len(id_fields) != 2:
+                raise ValueError("%s: style %s does not have an MSB and an LSB" % (style_list_path, fields[0]))
+
+            msb, lsb = (int(field, 16) for field in id_fields)
+            if msb > 0x7F or lsb > 0x7F:
+                raise ValueError("%s: style %s has an MSB or LSB above 7F" % (style_list_path, fields[0]))
+
+            styles.append((int(fields[0]), fields[1], int(fields[3]), fields[4], (msb << 8) | lsb))
+
+    orders = [style[0] for style in styles]
+    if orders != list(range(1, len(styles) + 1)):
+        raise ValueError("%s: the styles are not numbered 1 to %d" % (style_list_path, len(styles)))
+
+    style_nums = [style[4] for style in styles]
+    if len(set(style_nums)) != len(style_nums):
+        raise ValueError("%s: a style number is used twice" % style_list_path)
+
+    return styles
+
+
+def get_categories(styles):
+    categories = []
+    for style in styles:
+        if style[1] not in categories:
+            categories.append(style[1])
+    return categories
+
+
+def generate_catalog(styles):
+    """Returns the header's text."""
+    categories = get_categories(styles)
+
+    # The entries are sorted by style number, for binary search; the names are packed in the same order.
+    entries = sorted(styles, key=lambda style: style[4])
+    entry_indexes = {style[4]: index for index, style in enumerate(entries)}
+
+    name_offsets = []
+    names = ""
+    for entry in entries:
+        name_offsets.append(len(names))
+        names += entry[3]
+
+    if len(names) > 0xFFFF:
+        raise ValueError("the packed names do not fit 16-bit offsets")
+
+    lines = []
+    lines.append("// This file is generated by tools/generate_style_catalog.py from \"%s\"; do not edit it." % STYLE_LIST_FILE)
+    lines.append("// It is included only by StyleCatalog.cpp.")
+    lines.append("")
+    lines.append("#ifndef PsrSx900StyleCatalogData_H")
+    lines.append("#define PsrSx900StyleCatalogData_H")
+    lines.append("")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("#include \"StyleCatalog.h\"")
+    lines.append("")
+    lines.append("const uint16_t NumCatalogStyleEntries = %d;" % len(entries))
+    lines.append("const uint8_t NumCatalogStyleCategories = %d;" % len(categories))
+    lines.append("const uint16_t NumCatalogNameChars = %d;" % len(names))
+    lines.append("")
+    lines.append("// The category names, in catalog order.")
+    for index, category in enumerate(categories):
+        lines.append("const char CatalogCategoryName%d[] PROGMEM = \"%s\";" % (index, category))
+    lines.append("const char* const CatalogCategoryNames[NumCatalogStyleCategories] PROGMEM = {%s};"
+                 % ", ".join("CatalogCategoryName%d" % index for index in range(len(categories))))
+    lines.append("")
+    lines.append("// The entries, sorted by style number: {styleNum, nameOffset, categoryIndex}.")
+    lines.append("const StyleCatalogEntry CatalogStyleEntries[NumCatalogStyleEntries] PROGMEM = {")
+    for index, entry in enumerate(entries):
+        separator = "," if index < len(entries) - 1 else ""
+        lines.append("  {0x%04X, %d, %d}%s // %s" % (entry[4], name_offsets[index], categories.index(entry[1]), separator, entry[3]))
+    lines.append("};")
+    lines.append("")
+    lines.append("// The entry index of each style, in catalog order.")
+    lines.append("const uint16_t CatalogOrderEntryIndexes[NumCatalogStyleEntries] PROGMEM = {")
+    order_indexes = [str(entry_indexes[style[4]]) for style in styles]
+    for start in range(0, len(order_indexes), 16):
+        separator = "," if start + 16 < len(order_indexes) else ""
+        lines.append("  " + ", ".join(order_indexes[start:start + 16]) + separator)
+    lines.append("};")
+    lines.append("")
+    lines.append("// The style names, packed without terminators, in entry order.")
+    lines.append("const char CatalogNameChars[NumCatalogNameChars + 1] PROGMEM =")
+    for start in range(0, len(names), 96):
+        lines.append("  \"%s\"" % names[start:start + 96].replace("\\", "\\\\").replace("\"", "\\\""))
+    lines[-1] += ";"
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def parse_catalog(text):
+    """Parses a generated header back into styles, in catalog order, as (category, name, style number) tuples."""
+    categories = re.findall(r"CatalogCategoryName\d+\[\] PROGMEM = \"(.*)\";", text)
+    entries = [(int(num, 16), int(offset), int(category))
+               for num, offset, category in re.findall(r"^  \{0x([0-9A-F]{4}), (\d+), (\d+)\}", text, re.MULTILINE)]
+    order_block = text.split("CatalogOrderEntryIndexes")[1].split("};")[0].split("{")[1]
+    order_indexes = [int(index) for index in re.findall(r"\d+", order_block)]
+    name_block = text.split("CatalogNameChars[NumCatalogNameChars + 1] PROGMEM =")[1].split(";")[0]
+    names = "".join(re.findall(r"\"((?:[^\"\\\\]|\\\\.)*)\"", name_block)).replace("\\\"", "\"").replace("\\\\", "\\")
+
+    styles = []
+    for entry_index in order_indexes:
+        style_num, offset, category = entries[entry_index]
+        end = entries[entry_index + 1][1] if entry_index + 1 < len(entries) else len(names)
+        styles.append((categories[category], names[offset:end], style_num))
+
+    if any(entries[i][0] >= entries[i + 1][0] for i in range(len(entries) - 1)):
+        raise ValueError("the entries are not sorted by style number")
+
+    return styles
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, encoding="ascii") as existing:
+            if existing.read() == text:
+                return False
+    with open(path, "w", encoding="ascii", newline="\n") as output:
+        output.write(text)
+    return True
+
+
+def generate(project_dir):
+    styles = read_styles(os.path.join(project_dir, STYLE_LIST_FILE))
+    if write_if_changed(os.path.join(project_dir, CATALOG_FILE), generate_catalog(styles)):
+        print("Generated %s with %d styles." % (CATALOG_FILE, len(styles)))
+
+
+def check(project_dir):
+    styles = read_styles(os.path.join(project_dir, STYLE_LIST_FILE))
+    with open(os.path.join(project_dir, CATALOG_FILE), encoding="ascii") as catalog:
+        text = catalog.read()
+
+    if text != generate_catalog(styles):
+        print("%s is out of date; run tools/generate_style_catalog.py." % CATALOG_FILE)
+        return 1
+
+    expected = [(style[1], style[3], style[4]) for style in styles]
+    if parse_catalog(text) != expected:
+        print("%s does not round-trip against %s." % (CATALOG_FILE, STYLE_LIST_FILE))
+        return 1
+
+    print("%s is up to date, and round-trips %d styles." % (CATALOG_FILE, len(styles)))
+    return 0
+
+
+def main():
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    if "--check" in sys.argv[1:]:
+        return check(project_dir)
+    generate(project_dir)
+    return 0
+
+
+if "Import" in globals():
+    # Run by PlatformIO, as a pre: extra script.
+    Import("env")  # noqa: F821
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+elif __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""Reports the Uno flash and RAM use of two builds of MidiAccompanimentController, and the difference.
+
+Each build is a copy of the project, built with "pio run -e uno"; the sizes are those PlatformIO prints,
+"Flash: ... (used N bytes ...)" and "RAM: ... (used N bytes ...)". RAM is the static data and BSS; the stack is not included.
+
+Examples:
+  size_report.py --base HEAD~1               the working tree against the revision HEAD~1
+  size_report.py --toggle SCAN_PEDAL_PORTS   the working tree with the directive as it is, and toggled
+  size_report.py --base HEAD~1 --toggle SEND_PEDAL_LINK
+                                             both builds with the directive toggled
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+DIRECTIVES_HEADER = os.path.join("src", "MidiAccompanimentController.h")
+SIZE_PATTERN = re.compile(r"^(RAM|Flash):.*\(used (\d+) bytes", re.MULTILINE)
+
+
+def copy_working_tree(project_dir, build_dir):
+    shutil.copytree(project_dir, build_dir, ignore=shutil.ignore_patterns(".git", ".pio"))
+
+
+def copy_revision(project_dir, revision, build_dir):
+    os.makedirs(build_dir)
+    archive = subprocess.run(["git", "-C", project_dir, "archive", revision], check=True, stdout=subprocess.PIPE).stdout
+    subprocess.run(["tar", "-x", "-C", build_dir], input=archive, check=True)
+
+
+def toggle_directive(build_dir, name):
+    """Comments out the directive's #define if it is defined, or uncomments it if it is commented out."""
+    path = os.path.join(build_dir, DIRECTIVES_HEADER)
+    with open(path) as header:
+        text = header.read()
+
+    pattern = re.compile(r"^(//\s*)?#define %s[ \t]*$" % re.escape(name), re.MULTILINE)
+    match = pattern.search(text)
+    if match is None:
+        raise ValueError("%s has no #define %s line" % (DIRECTIVES_HEADER, name))
+
+    toggled = "#define " + name if match.group(1) else "// #define " + name
+    with open(path, "w") as header:
+        header.write(text[:match.start()] + toggled + text[match.end():])
+
+
+def build_sizes(build_dir):
+    """Builds the copy, and returns its flash and RAM use, in bytes."""
+    result = subprocess.run(["pio", "run", "-e", "uno", "-d", build_dir], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError("pio run failed in %s" % build_dir)
+
+    sizes = dict((name, int(used)) for name, used in SIZE_PATTERN.findall(result.stdout))
+    if "Flash" not in sizes or "RAM" not in sizes:
+        raise RuntimeError("pio run printed no flash and RAM sizes")
+    return sizes["Flash"], sizes["RAM"]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--base", metavar="REVISION", help="build the first copy from this git revision, rather than the working tree")
+    parser.add_argument("--toggle", metavar="DIRECTIVE", help="toggle this directive of %s in the second copy; or in both, with --base" % DIRECTIVES_HEADER)
+    args = parser.parse_args()
+    if args.base is None and args.toggle is None:
+        parser.error("give --base, --toggle, or both")
+
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    work_dir = tempfile.mkdtemp(prefix="size_report_")
+    try:
+        base_dir = os.path.join(work_dir, "base")
+        changed_dir = os.path.join(work_dir, "changed")
+        if args.base is not None:
+            copy_revision(project_dir, args.base, base_dir)
+        else:
+            copy_working_tree(project_dir, base_dir)
+        copy_working_tree(project_dir, changed_dir)
+
+        if args.toggle is not None:
+            toggle_directive(changed_dir, args.toggle)
+            if args.base is not None:
+                toggle_directive(base_dir, args.toggle)
+
+        base_flash, base_ram = build_sizes(base_dir)
+        changed_flash, changed_ram = build_sizes(changed_dir)
+    except (ValueError, RuntimeError, OSError, subprocess.CalledProcessError) as error:
+        sys.stderr.write("size_report.py: %s\n" % error)
+        return 1
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    base_name = args.base if args.base is not None else "as is"
+    changed_name = "working tree" if args.base is not None else "toggled"
+    print("%-14s %8s %8s" % ("", "Flash", "RAM"))
+    print("%-14s %8d %8d" % (base_name, base_flash, base_ram))
+    print("%-14s %8d %8d" % (changed_name, changed_flash, changed_ram))
+    print("%-14s %+8d %+8d" % ("difference", changed_flash - base_flash, changed_ram - base_ram))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Generates and verifies MidiAccompanimentController configuration SysEx messages.
+
+The message format is described in src/SysExConfig/SysExConfigProtocol.h:
+F0 7D 02 cc pp ... pp kk kk F7, where kk kk is the CRC-8 of 02, cc and pp, high nibble first.
+
+Examples:
+  sysex_config.py encode action 0 press SectionSwitchOn 0x10 0
+  sysex_config.py encode style 5 0x0128 --apply --persist -o config.syx
+  sysex_config.py encode tempo 120 60 200 debounce 20 --apply
+  sysex_config.py verify config.syx
+"""
+
+import argparse
+import sys
+
+MANUFACTURER_ID = 0x7D
+MESSAGE_TYPE = 0x02
+
+SET_PEDAL_ACTION = 0x01
+SET_PEDAL_STYLE = 0x02
+SET_TEMPO_LIMITS = 0x03
+SET_DEBOUNCE = 0x04
+APPLY_CONFIG = 0x05
+REVERT_CONFIG = 0x06
+
+PAYLOAD_SIZES = {SET_PEDAL_ACTION: 7, SET_PEDAL_STYLE: 5, SET_TEMPO_LIMITS: 6, SET_DEBOUNCE: 1, APPLY_CONFIG: 1, REVERT_CONFIG: 0}
+
+PERSIST_FLAG = 0x01
+
+# The PedalActionType values, in src/PedalAction.h order.
+ACTION_TYPES = ["NoAction", "SectionSwitchOn", "SectionSwitchOff", "SelectStyle", "TempoUp", "TempoDown",
+                "NextRegistrationBank", "NextSong", "PreviousSong"]
+EDGES = ["press", "release"]
+
+
+def crc8_ccitt(data):
+    """Returns the CRC-8 that avr-libc's _crc8_ccitt_update() computes: polynomial 0x07, initial value 0."""
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def nibbles(value):
+    if not 0 <= value <= 0xFF:
+        raise ValueError("8-bit value out of range: %d" % value)
+    return [value >> 4, value & 0x0F]
+
+
+def param_nibbles(value):
+    """Returns the nibbles of an action parameter; the parameters are sent in the keyboard's SysEx messages, so they are 7 bits."""
+    if not 0 <= value <= 0x7F:
+        raise ValueError("action parameter out of range 0..0x7F: %d" % value)
+    return nibbles(value)
+
+
+def encode_message(command, payload):
+    body = [MESSAGE_TYPE, command] + payload
+    if any(byte > 0x7F for byte in body):
+        raise ValueError("payload byte out of range")
+    return bytes([0xF0, MANUFACTURER_ID] + body + nibbles(crc8_ccitt(body)) + [0xF7])
+
+
+def parse_int(text):
+    return int(text, 0)
+
+
+def encode_commands(words):
+    """Encodes the commands in words; each command name is followed by its arguments."""
+    messages = []
+    i = 0
+    while i < len(words):
+        name = words[i]
+        if name == "action":
+            pedal, edge, action_type, param0, param1 = words[i + 1:i + 6]
+            type_index = ACTION_TYPES.index(action_type) if action_type in ACTION_TYPES else parse_int(action_type)
+            payload = [parse_int(pedal), EDGES.index(edge), type_index] + param_nibbles(parse_int(param0)) + param_nibbles(parse_int(param1))
+            messages.append(encode_message(SET_PEDAL_ACTION, payload))
+            i += 6
+        elif name == "style":
+            pedal, style_num = parse_int(words[i + 1]), parse_int(words[i + 2])
+            messages.append(encode_message(SET_PEDAL_STYLE, [pedal] + param_nibbles(style_num >> 8) + param_nibbles(style_num & 0xFF)))
+            i += 3
+        elif name == "tempo":
+            default, minimum, maximum = (parse_int(word) for word in words[i + 1:i + 4])
+            messages.append(encode_message(SET_TEMPO_LIMITS, nibbles(default) + nibbles(minimum) + nibbles(maximum)))
+            i += 4
+        elif name == "debounce":
+            messages.append(encode_message(SET_DEBOUNCE, [parse_int(words[i + 1])]))
+            i += 2
+        elif name == "revert":
+            messages.append(encode_message(REVERT_CONFIG, []))
+            i += 1
+        else:
+            raise ValueError("unknown command: %s" % name)
+    return messages
+
+
+def split_messages(data):
+    messages = []
+    start = None
+    for index, byte in enumerate(data):
+        if byte == 0xF0:
+            start = index
+        elif byte == 0xF7 and start is not None:
+            messages.append(data[start:index + 1])
+            start = None
+    return messages
+
+
+def verify_message(message):
+    """Returns an error string, or None if the message is a valid configuration message."""
+    body = message[1:-1]
+    if len(body) < 3 or body[0] != MANUFACTURER_ID or body[1] != MESSAGE_TYPE:
+        return "not a configuration message"
+    command = body[2]
+    if command not in PAYLOAD_SIZES:
+        return "unknown command %02X" % command
+    if len(body) != 3 + PAYLOAD_SIZES[command] + 2:
+        return "bad length %d" % len(body)
+    if any(byte > 0x7F for byte in body):
+        return "byte with the high bit set"
+    crc = (body[-2] << 4) | body[-1]
+    if crc != crc8_ccitt(body[1:-2]):
+        return "bad CRC %02X" % crc
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    subparsers = parser.add_subparsers(dest="mode")
+
+    encode_parser = subparsers.add_parser("encode", help="encode configuration commands")
+    encode_parser.add_argument("commands", nargs="+", help="action PEDAL EDGE TYPE P0 P1 | style PEDAL STYLENUM | "
+                               "tempo DEFAULT MIN MAX | debounce MS | revert")
+    encode_parser.add_argument("--apply", action="store_true", help="apply the configuration after the commands")
+    encode_parser.add_argument("--persist", action="store_true", help="also save the applied configuration to EEPROM")
+    encode_parser.add_argument("-o", "--output", help="write a .syx file instead of printing hex")
+
+    verify_parser = subparsers.add_parser("verify", help="verify the messages of a .syx file")
+    verify_parser.add_argument("file")
+
+    args = parser.parse_args()
+
+    if args.mode == "encode":
+        messages = encode_commands(args.commands)
+        if args.apply or args.persist:
+            messages.append(encode_message(APPLY_CONFIG, [PERSIST_FLAG if args.persist else 0]))
+        if args.output:
+            with open(args.output, "wb") as output:
+                output.write(b"".join(messages))
+        else:
+            for message in messages:
+                print(" ".join("%02X" % byte for byte in message))
+        return 0
+
+    if args.mode == "verify":
+        with open(args.file, "rb") as input_file:
+            messages = split_messages(input_file.read())
+        num_errors = 0
+        for index, message in enumerate(messages):
+            error = verify_message(message)
+            if error:
+                num_errors += 1
+            print("%d: %s" % (index, error or "OK"))
+        return 1 if num_errors or not messages else 0
+
+    parser.print_help()
+    return 2
+
+
+if __name__ == "__main__":
+    sys.exit(main())